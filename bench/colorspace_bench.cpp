@@ -0,0 +1,117 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "colorspace.hpp"
+
+//@brief     : time the fastest of several runs of a function
+//@param f   : function to time
+//@param reps: number of runs
+//@return    : fastest run time in nanoseconds
+template <typename F>
+double timeBest(F f, const size_t reps = 5) {
+	double best = 0;
+	for(size_t i = 0; i < reps; i++) {
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		if(0 == i || ns < best) best = ns;
+	}
+	return best;
+}
+
+//@brief     : print a line of the results table
+//@param name: name of the benchmark
+//@param base: baseline time per value in nanoseconds (std::cbrt / std::pow / one color at a time)
+//@param fast: optimized time per value in nanoseconds (fastCbrt / Gamma::Fast or Gamma::Table / batched)
+void report(const std::string& name, const double base, const double fast) {
+	std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2)
+	          << std::setw(10) << base << std::setw(10) << fast << std::setw(9) << base / fast << "x\n";
+}
+
+//@brief     : benchmark std::cbrt against the vectorizable approximation used by the batched conversions
+//@param n   : number of values
+//@param type: name of T for the report
+template <typename T>
+void benchCbrt(const size_t n, const std::string& type) {
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<T> dist(T(0.008856), T(1));//the range xyz2luv / xyz2lab take cube roots over
+	std::vector<T> x(n), y(n);
+	for(T& v : x) v = dist(gen);
+
+	std::vector<T> z(n);
+	const double base = timeBest([&](){for(size_t i = 0; i < n; i++) y[i] = std::cbrt(x[i]);});
+	const double fast = timeBest([&](){for(size_t i = 0; i < n; i++) z[i] = color::detail::fastCbrt(x[i]);});
+	T err = 0;//largest relative error (also keeps the loops from being optimized away)
+	for(size_t i = 0; i < n; i++) err = std::max(err, std::fabs(z[i] - y[i]) / y[i]);
+	report("cbrt<" + type + ">", base / n, fast / n);
+	std::cout << "  max relative error " << std::scientific << std::setprecision(1) << err << '\n';
+}
+
+//@brief     : benchmark the approximate sRGB transfer functions against std::pow (each run copies the inputs first so every mode sees the same values)
+//@param n   : number of values
+//@param type: name of T for the report
+template <typename T>
+void benchTransfer(const size_t n, const std::string& type) {
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<T> dist(T(0), T(1));
+	std::vector<T> x(n), y(n), ref(n);
+	for(T& v : x) v = dist(gen);
+
+	const color::detail::Transfer<T>& trc = color::detail::sRGBTransfer<T>();
+	for(const bool enc : {true, false}) {
+		auto run = [&](const color::Gamma gam) {
+			std::copy(x.begin(), x.end(), y.begin());
+			if(enc) trc.encode(y.data(), n, gam); else trc.decode(y.data(), n, gam);
+		};
+		const double base = timeBest([&](){run(color::Gamma::Exact);});
+		std::copy(y.begin(), y.end(), ref.begin());
+		for(const color::Gamma gam : {color::Gamma::Fast, color::Gamma::Table}) {
+			const double fast = timeBest([&](){run(gam);});
+			T err = 0;//largest absolute error against std::pow
+			for(size_t i = 0; i < n; i++) err = std::max(err, std::fabs(y[i] - ref[i]));
+			report(std::string(enc ? "encode<" : "decode<") + type + (color::Gamma::Fast == gam ? ", fast>" : ", table>"), base / n, fast / n);
+			std::cout << "  max absolute error " << std::scientific << std::setprecision(1) << err << '\n';
+		}
+	}
+}
+
+//@brief     : benchmark batched rgb -> Luv / Lab against converting one color at a time
+//@param n   : number of colors
+//@param type: name of T for the report
+template <typename T>
+void benchRgb(const size_t n, const std::string& type) {
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<T> dist(T(0), T(1));
+	std::vector<T> rgb(3 * n), cie(3 * n);
+	for(T& v : rgb) v = dist(gen);
+
+	for(const color::Gamma gam : {color::Gamma::Exact, color::Gamma::Fast}) {
+		const std::string suffix = "<" + type + (color::Gamma::Exact == gam ? ", exact>" : ", fast>");
+		double base = timeBest([&](){for(size_t i = 0; i < n; i++) color::rgb2luv(rgb.data() + 3 * i, cie.data() + 3 * i, (T const*)NULL, gam);});
+		double fast = timeBest([&](){color::rgb2luv(rgb.data(), cie.data(), n, color::Layout::Interleaved, (T const*)NULL, gam);});
+		report("rgb2luv" + suffix, base / n, fast / n);
+		base = timeBest([&](){for(size_t i = 0; i < n; i++) color::rgb2lab(rgb.data() + 3 * i, cie.data() + 3 * i, (T const*)NULL, gam);});
+		fast = timeBest([&](){color::rgb2lab(rgb.data(), cie.data(), n, color::Layout::Interleaved, (T const*)NULL, gam);});
+		report("rgb2lab" + suffix, base / n, fast / n);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	const size_t n = argc > 1 ? (size_t)std::atol(argv[1]) : 1 << 20;//number of values / colors
+	std::cout << n << " values, ns per value\n";
+	std::cout << std::left << std::setw(32) << "benchmark" << std::right << std::setw(10) << "baseline" << std::setw(10) << "optimized" << std::setw(10) << "speedup" << '\n';
+	benchCbrt<float >(n, "float" );
+	benchCbrt<double>(n, "double");
+	benchTransfer<float >(n, "float" );
+	benchTransfer<double>(n, "double");
+	benchRgb <float >(n, "float" );
+	benchRgb <double>(n, "double");
+	return 0;
+}
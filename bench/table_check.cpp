@@ -0,0 +1,399 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+#include "colormap.hpp"
+
+//@brief    : Delta E*uv between two sRGB colors
+//@param a  : first color
+//@param b  : second color
+//@return   : distance between the colors in Luv
+double deltaE(double const * const a, double const * const b) {
+	double la[3], lb[3];
+	color::rgb2luv(a, la);
+	color::rgb2luv(b, lb);
+	double d2 = 0;
+	for(size_t k = 0; k < 3; k++) d2 += (la[k] - lb[k]) * (la[k] - lb[k]);
+	return std::sqrt(d2);
+}
+
+//@brief  : largest difference between two 8 bit rgb colors
+//@param a: first color
+//@param b: second color
+//@return : largest absolute channel difference
+int diff8(uint8_t const * const a, uint8_t const * const b) {
+	int d = 0;
+	for(size_t k = 0; k < 3; k++) d = std::max(d, std::abs(int(a[k]) - int(b[k])));
+	return d;
+}
+
+//@brief          : print a line of the results table and check it
+//@param name     : name of the table
+//@param reported : error the table reports for itself (maxDeltaE)
+//@param sampled  : largest Delta E*uv found by random sampling
+//@param d8       : largest 8 bit channel difference found by random sampling
+//@param max8     : largest allowed 8 bit channel difference
+//@return         : true if the sampled error is within the reported error and 8 bit colors are within max8
+bool report(const std::string& name, const double reported, const double sampled, const int d8, const int max8 = 1) {
+	const bool pass = sampled <= reported && d8 <= max8;
+	std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(7)
+	          << std::setw(14) << reported << std::setw(14) << sampled << std::setw(6) << d8 << (pass ? "  ok\n" : "  FAIL\n");
+	return pass;
+}
+
+//@brief  : convert a direction to the fractional spherical coordinates the sphere tables bake their texels at
+//@param v: direction (need not be normalized)
+//@param p: location to write polar angle [0,1]
+//@param a: location to write azimuthal angle [0,1]
+void sphereAngles(double const * const v, double& p, double& a) {
+	const double len = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+	p = std::acos(std::max(-1.0, std::min(1.0, v[2] / len))) / M_PI;
+	a = std::atan2(v[1], v[0]) / (M_PI * 2);
+	if(std::signbit(a)) a += 1;
+}
+
+//@brief    : describe a center color and symmetry
+//@param w0 : true/false for white/black center
+//@param sym: type of inversion symmetry
+//@return   : suffix for table names
+std::string symName(const bool w0, const colormap::Sym sym) {
+	const char* names[3] = {"None", "Azimuth", "Polar"};
+	return std::string(w0 ? "<w, " : "<k, ") + names[colormap::Sym::None == sym ? 0 : colormap::Sym::Azimuth == sym ? 1 : 2] + ">";
+}
+
+//@brief       : compare a baked ramp or cyclic table against evaluating its map
+//@param name  : name of the map
+//@param map   : sRGB map to bake
+//@param map8  : 8 bit version of the same map
+//@param cyclic: true/false for a cyclic / ramp map
+//@param n     : number of random positions
+//@return      : true if the check passed
+bool checkBaked(const std::string& name, colormap::ramp::func<double> map, colormap::ramp::func8<double> map8, const bool cyclic, const size_t n) {
+	const colormap::BakedLut<double> lut(map, cyclic);
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<double> dist(0, 1);
+	double sampled = 0;
+	int d8 = 0;
+	for(size_t i = 0; i < n; i++) {
+		const double t = dist(gen);
+		double exact[3], table[3];
+		uint8_t exact8[3], table8[3];
+		map(t, exact);
+		lut(t, table);
+		map8(&t, exact8, 1, false, color::Profile<double>::sRGB(), colormap::Backend::Float);
+		lut(t, table8);
+		sampled = std::max(sampled, deltaE(exact, table));
+		d8 = std::max(d8, diff8(exact8, table8));
+	}
+	return report((cyclic ? "cyclic::" : "ramp::") + name, lut.maxDeltaE(), sampled, d8);
+}
+
+//@brief     : compare a disk polar table against evaluating its map
+//@param name: name of the map
+//@param map : map to bake
+//@param map8: 8 bit version of the same map
+//@param w0  : true/false for white/black center
+//@param sym : type of inversion symmetry
+//@param n   : number of random coordinates
+//@return    : true if the random and dense checks passed
+//@note      : the table only refines cells whose coarse error is at least half the worst, the dense check samples every cell on a regular grid
+//             (offset from the points the table measures) so a skipped cell hiding a larger error fails
+bool checkDisk(const std::string& name, colormap::disk::pfunc<double> map, colormap::disk::func8<double> map8, const bool w0, const colormap::Sym sym, const size_t n) {
+	const color::Profile<double>& prof = color::Profile<double>::sRGB();
+	const colormap::DiskLut<double> lut(map, w0, sym, prof);
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<double> dist(0, 1);
+	double sampled = 0;
+	int d8 = 0;
+	for(size_t i = 0; i < n; i++) {
+		const double r = dist(gen), t = dist(gen);
+		double exact[3], table[3];
+		uint8_t exact8[3], table8[3];
+		map(r, t, exact, w0, sym, prof);
+		lut(r, t, table);
+		map8(&r, &t, exact8, 1, w0, sym, false, prof, colormap::Backend::Float);
+		lut(r, t, table8);
+		sampled = std::max(sampled, deltaE(exact, table));
+		d8 = std::max(d8, diff8(exact8, table8));
+	}
+	bool pass = report("disk::" + name + symName(w0, sym), lut.maxDeltaE(), sampled, d8);
+
+	//dense regular sample of every cell
+	const size_t nr = (colormap::DiskLut<double>::DefaultRadii - 1) * 8, nt = colormap::DiskLut<double>::DefaultAngles * 8;//8 x 8 samples per cell
+	sampled = 0;
+	for(size_t j = 0; j < nr; j++) {
+		const double r = (j + 0.3) / nr;
+		for(size_t i = 0; i < nt; i++) {
+			const double t = (i + 0.3) / nt;
+			double exact[3], table[3];
+			map(r, t, exact, w0, sym, prof);
+			lut(r, t, table);
+			sampled = std::max(sampled, deltaE(exact, table));
+		}
+	}
+	pass &= report("disk::" + name + symName(w0, sym) + "(dense)", lut.maxDeltaE(), sampled, 0);
+	return pass;
+}
+
+//@brief       : compare a bicone's interpolated hue table against evaluating its equator spline at every hue
+//@param name  : name of the bicone
+//@param bi    : bicone to check
+//@param mirror: true/false if colors should be smooth with/without a mirror plane at l = 0.5
+//@param n     : number of random coordinates
+//@return      : true if the check passed
+template <typename Bicone>
+bool checkHue(const std::string& name, const Bicone& bi, const bool mirror, const size_t n) {
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<double> dist(0, 1);
+	double sampled = 0;
+	int d8 = 0;
+	for(size_t i = 0; i < n; i++) {
+		const double h = dist(gen), l = dist(gen);
+		double exact[3], table[3];
+		uint8_t exact8[3], table8[3];
+		bi.exact(h, l, exact, mirror);
+		bi(h, l, table, mirror);
+		for(size_t k = 0; k < 3; k++) {
+			exact8[k] = (uint8_t)std::lround(std::min(std::max(exact[k], 0.0), 1.0) * 255);
+			table8[k] = (uint8_t)std::lround(std::min(std::max(table[k], 0.0), 1.0) * 255);
+		}
+		sampled = std::max(sampled, deltaE(exact, table));
+		d8 = std::max(d8, diff8(exact8, table8));
+	}
+	return report("hue::" + name + (mirror ? "<mirror>" : ""), bi.hueDeltaE(), sampled, d8);
+}
+
+//@brief     : compare a sphere cube map against evaluating its map, looked up by coordinates and by direction
+//@param name: name of the map
+//@param map : map to bake
+//@param map8: 8 bit version of the same map
+//@param w0  : true/false for white/black center
+//@param sym : type of inversion symmetry
+//@param n   : number of random coordinates (and directions)
+//@return    : true if the random and dense checks passed
+//@note      : the table only refines texels whose coarse error is at least half the worst, the dense check samples every texel of every stored face on a
+//             regular grid (offset from the points the table measures) so a skipped texel hiding a larger error fails
+bool checkSphere(const std::string& name, colormap::sphere::pfunc<double> map, colormap::sphere::func8<double> map8, const bool w0, const colormap::Sym sym, const size_t n) {
+	const color::Profile<double>& prof = color::Profile<double>::sRGB();
+	const colormap::SphereLut<double> lut(map, w0, sym, prof);
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<double> dist(0, 1);
+	double sampled = 0;
+	int d8 = 0;
+	for(size_t i = 0; i < n; i++) {
+		const double x = dist(gen), y = dist(gen);//the table takes its coordinates in the same order as the map
+		double exact[3], table[3];
+		uint8_t exact8[3], table8[3];
+		map(x, y, exact, w0, sym, prof);
+		lut(x, y, table);
+		map8(&x, &y, exact8, 1, w0, sym, false, prof, colormap::Backend::Float);
+		lut(&x, &y, table8, 1);
+		sampled = std::max(sampled, deltaE(exact, table));
+		d8 = std::max(d8, diff8(exact8, table8));
+	}
+	bool pass = report("sphere::" + name + symName(w0, sym), lut.maxDeltaE(), sampled, d8);
+
+	//directions are looked up by face instead of by angle, the exact color of v is the map at its polar and azimuthal angle (in the order the table bakes them)
+	std::normal_distribution<double> normal(0, 1);
+	std::uniform_real_distribution<double> scale(0.5, 2);
+	sampled = 0;
+	d8 = 0;
+	for(size_t i = 0; i < n; i++) {
+		double v[3] = {normal(gen), normal(gen), normal(gen)}, p, a;
+		sphereAngles(v, p, a);
+		const double s = scale(gen);//directions don't need to be normalized
+		for(size_t k = 0; k < 3; k++) v[k] *= s;
+		double exact[3], table[3];
+		uint8_t exact8[3], table8[3];
+		map(p, a, exact, w0, sym, prof);
+		lut(v, table);
+		map8(&p, &a, exact8, 1, w0, sym, false, prof, colormap::Backend::Float);
+		lut(v, table8, 1);
+		sampled = std::max(sampled, deltaE(exact, table));
+		d8 = std::max(d8, diff8(exact8, table8));
+	}
+	pass &= report("sphere::" + name + symName(w0, sym) + "(v)", lut.maxDeltaE(), sampled, d8);
+
+	//dense regular sample of every texel (inversion symmetric maps only store the positive faces)
+	const size_t m = (colormap::SphereLut<double>::DefaultSize - 1) * 4;//4 x 4 samples per texel
+	sampled = 0;
+	for(size_t f = 0; f < (colormap::Sym::None == sym ? 6 : 3); f++) {
+		for(size_t j = 0; j < m; j++) {
+			for(size_t i = 0; i < m; i++) {
+				double v[3], p, a;
+				v[f % 3] = f < 3 ? 1 : -1;
+				v[(f + 1) % 3] = (i + 0.3) / m * 2 - 1;
+				v[(f + 2) % 3] = (j + 0.3) / m * 2 - 1;
+				sphereAngles(v, p, a);
+				double exact[3], table[3];
+				map(p, a, exact, w0, sym, prof);
+				lut(v, table);
+				sampled = std::max(sampled, deltaE(exact, table));
+			}
+		}
+	}
+	pass &= report("sphere::" + name + symName(w0, sym) + "(dense)", lut.maxDeltaE(), sampled, 0);
+	return pass;
+}
+
+//@brief     : compare a ball voxel table against evaluating its map
+//@param name: name of the map
+//@param map : map to bake
+//@param map8: 8 bit version of the same map
+//@param w0  : true/false for white/black center
+//@param sym : type of inversion symmetry
+//@param n   : number of random coordinates
+//@return    : true if the random and dense checks passed
+//@note      : the table only refines voxels whose center error is at least half the worst, the dense check samples every voxel on a regular grid
+//             (offset from the points the table measures) so a skipped voxel hiding a larger error fails
+bool checkBall(const std::string& name, colormap::ball::pfunc<double> map, colormap::ball::func8<double> map8, const bool w0, const colormap::Sym sym, const size_t n) {
+	const color::Profile<double>& prof = color::Profile<double>::sRGB();
+	const colormap::BallLut<double> lut(map, w0, sym, prof);
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<double> dist(0, 1);
+	double sampled = 0;
+	int d8 = 0;
+	for(size_t i = 0; i < n; i++) {
+		const double r = dist(gen), a = dist(gen), p = dist(gen);
+		double exact[3], table[3];
+		uint8_t exact8[3], table8[3];
+		map(r, a, p, exact, w0, sym, prof);
+		lut(r, a, p, table);
+		map8(&r, &a, &p, exact8, 1, w0, sym, false, prof, colormap::Backend::Float);
+		lut(&r, &a, &p, table8, 1);
+		sampled = std::max(sampled, deltaE(exact, table));
+		d8 = std::max(d8, diff8(exact8, table8));
+	}
+	bool pass = report("ball::" + name + symName(w0, sym), lut.maxDeltaE(), sampled, d8, 6);//dark channels of bright colors near the surface move a few steps for a few tenths of Delta E*uv
+
+	//dense regular sample of every voxel
+	typedef colormap::BallLut<double> Lut;
+	const size_t nr = (Lut::DefaultRadii - 1) * 2, na = Lut::DefaultAzimuths * 2, np = (Lut::DefaultPolars - 1) * 2;//2 x 2 x 2 samples per voxel
+	sampled = 0;
+	for(size_t k = 0; k < nr; k++) {
+		const double r = (k + 0.3) / nr;
+		for(size_t j = 0; j < np; j++) {
+			const double p = (j + 0.3) / np;
+			for(size_t i = 0; i < na; i++) {
+				const double a = (i + 0.3) / na;
+				double exact[3], table[3];
+				map(r, a, p, exact, w0, sym, prof);
+				lut(r, a, p, table);
+				sampled = std::max(sampled, deltaE(exact, table));
+			}
+		}
+	}
+	pass &= report("ball::" + name + symName(w0, sym) + "(dense)", lut.maxDeltaE(), sampled, 0);
+	return pass;
+}
+
+//@brief     : compare the fixed point backend against the floating point backend for every predefined map
+//@param name: name of the profile
+//@param prof: rgb color space to write colors in
+//@param n   : number of random coordinates
+//@return    : true if the check passed
+bool checkFixed(const std::string& name, const color::Profile<double>& prof, const size_t n) {
+	using namespace colormap;
+	std::mt19937_64 gen(0);
+	std::uniform_real_distribution<double> dist(0, 1);
+	std::vector<double> x(n), y(n), z(n);
+	for(size_t i = 0; i < n; i++) {
+		x[i] = dist(gen);
+		y[i] = dist(gen);
+		z[i] = dist(gen);
+	}
+	std::vector<uint8_t> flt(n * 3), fix(n * 3);
+	int d8 = 0;
+	auto compare = [&](){for(size_t i = 0; i < n; i++) d8 = std::max(d8, diff8(flt.data() + 3 * i, fix.data() + 3 * i));};
+	const ramp::func8<double> lines[9] = {ramp::gray<double>, ramp::fire<double>, ramp::ocean<double>, ramp::ice<double>, ramp::div<double>, cyclic::gray<double>, cyclic::four<double>, cyclic::six<double>, cyclic::div<double>};
+	for(const ramp::func8<double> f : lines) {
+		f(x.data(), flt.data(), n, false, prof, Backend::Float);
+		f(x.data(), fix.data(), n, false, prof, Backend::Fixed);
+		compare();
+	}
+	const disk  ::func8<double> disks  [2] = {disk  ::four<double>, disk  ::six<double>};
+	const sphere::func8<double> spheres[2] = {sphere::four<double>, sphere::six<double>};
+	const ball  ::func8<double> balls  [2] = {ball  ::four<double>, ball  ::six<double>};
+	for(const Sym sym : {Sym::None, Sym::Azimuth, Sym::Polar}) {
+		for(const bool w0 : {false, true}) {
+			for(size_t m = 0; m < 2; m++) {
+				disks  [m](x.data(), y.data(), flt.data(), n, w0, sym, false, prof, Backend::Float);
+				disks  [m](x.data(), y.data(), fix.data(), n, w0, sym, false, prof, Backend::Fixed);
+				compare();
+				spheres[m](x.data(), y.data(), flt.data(), n, w0, sym, false, prof, Backend::Float);
+				spheres[m](x.data(), y.data(), fix.data(), n, w0, sym, false, prof, Backend::Fixed);
+				compare();
+				balls  [m](x.data(), y.data(), z.data(), flt.data(), n, w0, sym, false, prof, Backend::Float);
+				balls  [m](x.data(), y.data(), z.data(), fix.data(), n, w0, sym, false, prof, Backend::Fixed);
+				compare();
+			}
+		}
+	}
+	return report("fixed::" + name, 0, 0, d8);//no table so only the 8 bit difference is checked
+}
+
+int main(int argc, char *argv[]) {
+	const size_t n = argc > 1 ? (size_t)std::atol(argv[1]) : 1 << 20;//number of random samples per table
+	std::cout << n << " random samples per table, Delta E*uv\n";
+	std::cout << std::left << std::setw(32) << "table" << std::right << std::setw(14) << "maxDeltaE" << std::setw(14) << "sampled" << std::setw(6) << "8bit" << '\n';
+	bool pass = true;
+
+	//baked ramps and cycles
+	using namespace colormap;
+	pass &= checkBaked("gray" , ramp::gray <double>, ramp::gray <double>, false, n);
+	pass &= checkBaked("fire" , ramp::fire <double>, ramp::fire <double>, false, n);
+	pass &= checkBaked("ocean", ramp::ocean<double>, ramp::ocean<double>, false, n);
+	pass &= checkBaked("ice"  , ramp::ice  <double>, ramp::ice  <double>, false, n);
+	pass &= checkBaked("div"  , ramp::div  <double>, ramp::div  <double>, false, n);
+	pass &= checkBaked("gray" , cyclic::gray<double>, cyclic::gray<double>, true, n);
+	pass &= checkBaked("four" , cyclic::four<double>, cyclic::four<double>, true, n);
+	pass &= checkBaked("six"  , cyclic::six <double>, cyclic::six <double>, true, n);
+	pass &= checkBaked("div"  , cyclic::div <double>, cyclic::div <double>, true, n);
+
+	//hue tables of the bicones
+	for(const bool mirror : {false, true}) {
+		pass &= checkHue("four", detail::Maps<double>::FourBi, mirror, n);
+		pass &= checkHue("six" , detail::Maps<double>::SixBi , mirror, n);
+	}
+
+	//disk polar tables
+	for(const Sym sym : {Sym::None, Sym::Azimuth, Sym::Polar}) {
+		for(const bool w0 : {false, true}) {
+			pass &= checkDisk("four", disk::four<double>, disk::four<double>, w0, sym, n);
+			pass &= checkDisk("six" , disk::six <double>, disk::six <double>, w0, sym, n);
+		}
+	}
+
+	//sphere cube maps
+	for(const Sym sym : {Sym::None, Sym::Azimuth, Sym::Polar}) {
+		for(const bool w0 : {false, true}) {
+			pass &= checkSphere("four", sphere::four<double>, sphere::four<double>, w0, sym, n);
+			pass &= checkSphere("six" , sphere::six <double>, sphere::six <double>, w0, sym, n);
+		}
+	}
+
+	//ball voxel tables
+	for(const Sym sym : {Sym::None, Sym::Azimuth, Sym::Polar}) {
+		for(const bool w0 : {false, true}) {
+			pass &= checkBall("four", ball::four<double>, ball::four<double>, w0, sym, n);
+			pass &= checkBall("six" , ball::six <double>, ball::six <double>, w0, sym, n);
+		}
+	}
+
+	//fixed point backend
+	pass &= checkFixed("sRGB"    , color::Profile<double>::sRGB    (), n);
+	pass &= checkFixed("adobeRGB", color::Profile<double>::adobeRGB(), n);
+	pass &= checkFixed("appleRGB", color::Profile<double>::appleRGB(), n);
+	pass &= checkFixed("palRGB"  , color::Profile<double>::palRGB  (), n);
+	pass &= checkFixed("ntscRGB" , color::Profile<double>::ntscRGB (), n);
+	pass &= checkFixed("cieRGB"  , color::Profile<double>::cieRGB  (), n);
+
+	std::cout << (pass ? "all tables within their reported error\n" : "some tables exceed their reported error\n");
+	return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -34,6 +34,7 @@
 #define _CET_LUT_HPP_
 
 #include <array>
+#include <cstdint>//uint8_t
 
 // 8 bit CET luts as {R,G,B,R,G,B,...}
 // see https://colorcet.com/gallery.html for more details
@@ -33,17 +33,29 @@
 #define _UNIFORM_COLORMAPS_
 
 #include <array>
-#include <algorithm>//copy, rotate, transform
-#include <type_traits>//is_floating_point
-#include <stdexcept>//out_of_range
+#include <algorithm>//copy, transform, any_of
+#include <type_traits>//is_floating_point, conditional, integral_constant
+#include <cmath>//floor, ceil, sqrt
+#include <cstdint>//int32_t, int64_t
+#include <stdexcept>//out_of_range, invalid_argument
+#include <limits>//quiet_NaN
 #include <functional>//function
 #include <vector>
+#include <string>
+#include <memory>//unique_ptr
+#include <mutex>//once_flag, call_once, mutex
 
-#include "colorspace.hpp"//luv2rgb
+#include "colorspace.hpp"//Profile
+#include "cet_lut.hpp"//CET tables
 
 //@brief: perceptually uniform color maps for ramps, cycles, disks, spheres and balls
 //@reference: Kovesi, Peter. "Good colour maps: How to design them." arXiv preprint arXiv:1509.03700 (2015). [ramp and cycle color maps]
 //@reference: Lenthe [disk, sphere, and ball color maps]
+//@note: requires c++14 (constexpr map evaluation), with c++17 the built in maps are also constant initialized (no construction on first use)
+
+#if !defined(_MSVC_LANG) && __cplusplus < 201402L//msvc only reports the standard in __cplusplus with /Zc:__cplusplus
+	#error "colormap.hpp requires c++14 or newer"
+#endif
 
 namespace colormap {
 
@@ -51,6 +63,13 @@ namespace colormap {
 	//                   Predefined Color Maps                    //
 	////////////////////////////////////////////////////////////////
 
+	//arithmetic used by the functions writing arrays of 8 bit colors
+	enum class Backend {
+		Float,//floating point map evaluation and Luv -> rgb conversion (reference)
+		Fixed,//Q16.16 fixed point map evaluation and integer Luv -> rgb conversion (for cores without fast floating point math)
+		Table,//interpolate a cached table of the floating point map (predefined disk, sphere, and ball maps only, everything else falls back to Float)
+	};
+
 	namespace ramp {
 		//@brief    : predefined perceptually uniform linear color maps
 		//@param t  : progress along ramp [0, 1]
@@ -61,6 +80,51 @@ namespace colormap {
 		template <typename Real> void ice  (const Real t, Real * const rgb);//black->magenta->blue   ->cyan  ->white
 		template <typename Real> void div  (const Real t, Real * const rgb);//blue  ->gray  ->red    (traditional divergent)
 		template <typename Real> using func = void (*)(const Real, Real * const);//typedef color function signature for convince
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void gray (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void fire (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void ocean(const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void ice  (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void div  (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> using pfunc = void (*)(const Real, Real * const, const color::Profile<Real>&);//typedef color function signature for convince
+
+		//@brief      : same as above but for arrays of positions written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles)
+		template <typename Real> void gray (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void fire (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void ocean(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void ice  (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void div  (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> using func8 = void (*)(Real const * const, uint8_t * const, const size_t, const bool, const color::Profile<Real>&, const Backend);//typedef color function signature for convince
+
+		//@brief     : compute colors for n evenly spaced positions along a ramp (0 -> 1 inclusive)
+		//@param ramp: color map function to use
+		//@param rgb : location to write n interleaved colors
+		//@param n   : number of positions
+		//@note      : the predefined maps sweep their splines incrementally (much faster than n individual calls)
+		template <typename Real> void sweep(func<Real> ramp, Real * const rgb, const size_t n);
+
+		//@brief     : map a fractional perceptual distance along a ramp to the position to evaluate it at (exact Delta E*uv uniformity)
+		//@param ramp: color map function to use
+		//@param u   : fractional distance along ramp in Delta E*uv [0, 1]
+		//@return    : position t along ramp such that the color distance from 0 -> t is u times the total
+		//@note      : a cached inverse arc length table is built on first use for each map (other functions are measured through their sampled sRGB colors)
+		template <typename Real> Real uniform(func<Real> ramp, const Real u);
+
+		//@brief    : CET perceptually uniform linear maps (e.g. ramp::cet<double, CET::L08>), same parameters as the predefined maps above
+		//@param Lut: 256 entry 8 bit sRGB table from cet_lut.hpp (L*, D*, R*, I*, CBL*, or CBD*)
+		//@note     : evaluated by linear interpolation between table entries instead of a spline (colors are converted for non sRGB profiles)
+		//            the fixed point backend interpolates the table in integers, within 1 of the floating point backend for sRGB (other profiles interpolate the Luv of
+		//            the entries through the integer kernel, within 2 since the floating point backend interpolates in sRGB), the table backend is the same as the floating point one
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb);
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
 	};
 
 	namespace cyclic {
@@ -72,6 +136,177 @@ namespace colormap {
 		template <typename Real> void six  (const Real t, Real * const rgb);//red  ->yellow->green->teal->blue->magenta->red (for 6 fold symmetry)
 		template <typename Real> void div  (const Real t, Real * const rgb);//blue ->gray  ->red  ->gray->blue (divergent)
 		template <typename Real> using func = void (*)(const Real, Real * const);//typedef color function signature for convince
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void gray (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void four (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void six  (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> void div  (const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real> using pfunc = void (*)(const Real, Real * const, const color::Profile<Real>&);//typedef color function signature for convince
+
+		//@brief      : same as above but for arrays of positions written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles)
+		template <typename Real> void gray(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void four(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void six (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void div (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> using func8 = void (*)(Real const * const, uint8_t * const, const size_t, const bool, const color::Profile<Real>&, const Backend);//typedef color function signature for convince
+
+		//@brief       : compute colors for n evenly spaced positions around a cycle (0 -> 1 inclusive)
+		//@param cyclic: color map function to use
+		//@param rgb   : location to write n interleaved colors
+		//@param n     : number of positions
+		//@note        : the predefined maps sweep their splines incrementally (much faster than n individual calls)
+		template <typename Real> void sweep(func<Real> cyclic, Real * const rgb, const size_t n);
+
+		//@brief       : map a fractional perceptual distance around a cycle to the position to evaluate it at (exact Delta E*uv uniformity)
+		//@param cyclic: color map function to use
+		//@param u     : fractional distance around cycle in Delta E*uv [0, 1]
+		//@return      : position t around cycle such that the color distance from 0 -> t is u times the total
+		//@note        : a cached inverse arc length table is built on first use for each map (other functions are measured through their sampled sRGB colors)
+		template <typename Real> Real uniform(func<Real> cyclic, const Real u);
+
+		//@brief    : CET perceptually uniform cyclic maps (e.g. cyclic::cet<double, CET::C2>), same parameters as the predefined maps above
+		//@param Lut: 256 entry 8 bit sRGB table from cet_lut.hpp (C* or CBC*), the last entry wraps back to the first
+		//@note     : evaluated by linear interpolation between table entries instead of a spline (colors are converted for non sRGB profiles)
+		//            the fixed point backend interpolates the table in integers, within 1 of the floating point backend for sRGB (other profiles interpolate the Luv of
+		//            the entries through the integer kernel, within 2 since the floating point backend interpolates in sRGB), the table backend is the same as the floating point one
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb);
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb, const color::Profile<Real>& prof);
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+	};
+
+	namespace detail {template <size_t N, typename Real> struct UniformLut;}
+	template <typename Real> class DynamicLut;
+	template <typename Real> class DynamicBicone;
+
+	//@brief: ramp or cyclic color map baked into a high resolution rgb table (an index computation and a linear interpolation per color)
+	template <typename Real>
+	class BakedLut {
+		public:
+			static const size_t DefaultSize = 4096;//default number of table entries
+			static const size_t ErrorGrid   =   16;//every interval is measured at ErrorGrid evenly spaced positions to find maxDeltaE
+
+			//@brief       : bake an sRGB color map
+			//@param map   : color map function to bake (ramp::func and cyclic::func have the same signature)
+			//@param cyclic: true/false to wrap around / clamp at the ends of the table
+			//@param n     : number of table entries (at least 2)
+			//@note        : the predefined maps are swept incrementally
+			BakedLut(ramp::func<Real> map, const bool cyclic, const size_t n = DefaultSize);
+
+			//@brief       : bake a color map in an arbitrary rgb color space
+			//@param map   : color map function to bake (ramp::pfunc and cyclic::pfunc have the same signature)
+			//@param prof  : rgb color space to write colors in
+			//@param cyclic: true/false to wrap around / clamp at the ends of the table
+			//@param n     : number of table entries (at least 2)
+			BakedLut(ramp::pfunc<Real> map, const color::Profile<Real>& prof, const bool cyclic, const size_t n = DefaultSize);
+
+			//@brief       : bake a spline color map
+			//@param lut   : spline to bake
+			//@param cyclic: true/false to wrap around / clamp at the ends of the table
+			//@param n     : number of table entries (at least 2)
+			//@param prof  : rgb color space to write colors in
+			template <size_t N>
+			BakedLut(const detail::UniformLut<N, Real>& lut, const bool cyclic, const size_t n = DefaultSize, const color::Profile<Real>& prof = color::Profile<Real>::sRGB());
+
+			//@brief     : bake a runtime spline color map (wraps around if the map is cyclic)
+			//@param lut : spline to bake
+			//@param n   : number of table entries (at least 2)
+			//@param prof: rgb color space to write colors in
+			BakedLut(const DynamicLut<Real>& lut, const size_t n = DefaultSize, const color::Profile<Real>& prof = color::Profile<Real>::sRGB());
+
+			//@brief       : get a table for a color map, baking it on first use (thread safe)
+			//@param map   : color map function to bake
+			//@param prof  : rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+			//@param cyclic: true/false to wrap around / clamp at the ends of the table
+			//@return      : cached table with DefaultSize entries
+			static const BakedLut& cached(ramp::pfunc<Real> map, const color::Profile<Real>& prof, const bool cyclic);
+
+			//@brief    : get the color at a fractional position
+			//@param t  : fractional position [0,1] (clamped for ramps, wrapped for cycles, nan is treated as 0)
+			//@param rgb: location to write rgb color [0,1]
+			void operator()(const Real t, Real * const rgb) const;
+
+			//@brief    : get the 8 bit color at a fractional position
+			//@param t  : fractional position [0,1] (clamped for ramps, wrapped for cycles, nan is treated as 0)
+			//@param rgb: location to write rgb color [0,255]
+			void operator()(const Real t, uint8_t * const rgb) const;
+
+			//@brief      : get 8 bit colors for an array of fractional positions
+			//@param t    : fractional positions [0,1]
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of positions
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			void operator()(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha = false) const;
+
+			//@brief : get the largest interpolation error of the table
+			//@return: maximum Delta E*uv between interpolated and exact colors, measured on a fine grid in every interval (peaks between grid points are bounded from the slopes around them)
+			Real maxDeltaE() const {return dE;}
+
+			//@brief : get the number of table entries
+			//@return: number of entries
+			size_t size() const {return num;}
+
+			//@brief : check if the table wraps around
+			//@return: true/false for cyclic/ramp
+			bool cyclic() const {return cyc;}
+
+		private:
+			//@brief       : fill the table from a sampler and measure the interpolation error
+			//@param sample: function to compute colors at m evenly spaced positions (0 -> 1 inclusive), void(const size_t m, Real * const rgb)
+			//@param prof  : rgb color space the colors are in
+			template <typename Sampler> void bake(Sampler sample, const color::Profile<Real>& prof);
+
+			//@brief  : find the entries bracketing a fractional position
+			//@param t: fractional position
+			//@param p: location to write pointer to entry at or before t
+			//@param q: location to write pointer to entry after t (wrapped back to the start of the table for cycles)
+			//@param f: location to write fractional distance from p to q [0,1]
+			void locate(const Real t, Real const *& p, Real const *& q, Real& f) const;
+
+			std::vector<Real> rgb;//interleaved table entries
+			size_t            num;//number of entries
+			bool              cyc;//true/false for wrap around / clamp
+			Real              dE ;//maximum interpolation error
+	};
+
+	//@brief: colors for every value of an 8 or 16 bit unsigned integer (integer images are colored by a gather instead of evaluating the map per pixel)
+	template <typename Int, typename T>
+	class IndexedLut {
+		static_assert(std::is_same<Int, uint8_t>::value || std::is_same<Int, uint16_t>::value, "indexed tables are only built for 8 and 16 bit unsigned integers");
+
+		public:
+			static const size_t Size = size_t(1) << (8 * sizeof(Int));//number of table entries
+
+			//@brief      : build a table for a range of values
+			//@param color: function to compute the color of a fractional position [0,1], void(const double t, T * const rgb) (e.g. a BakedLut or predefined map)
+			//@param vMin : value mapped to 0
+			//@param vMax : value mapped to 1 (if vMax == vMin everything in range maps to 0)
+			//@param alpha: true/false to write rgba (with alpha = 1 or 255) / rgb
+			//@param fill : value for all channels of values outside of [vMin, vMax]
+			//@note       : only values in [vMin, vMax] are colored so the cost of building the table is bounded by the range
+			template <typename Func> IndexedLut(const Func& color, const double vMin, const double vMax, const bool alpha = false, const T fill = T(0));
+
+			//@brief    : color an array of values
+			//@param v  : values to color
+			//@param rgb: location to write n interleaved colors
+			//@param n  : number of values
+			//@return   : true/false if any value fell outside/inside of [vMin, vMax] (and was filled)
+			bool operator()(Int const * const v, T * const rgb, const size_t n) const;
+
+			//@brief : get the number of channels per color
+			//@return: 3/4 for rgb/rgba
+			size_t channels() const {return stride;}
+
+		private:
+			std::vector<T> tbl   ;//interleaved colors for every value
+			size_t         stride;//channels per color
+			size_t         lo, hi;//range of values that aren't filled
 	};
 
 	//disk, sphere, and ball color maps can handle inversion symmetry
@@ -91,6 +326,22 @@ namespace colormap {
 		template <typename Real> void four (const Real r, const Real t, Real * const rgb, const bool w0 = false, const Sym sym = Sym::None);//red->yellow->green      ->blue         ->red (for 4 fold symmetry)
 		template <typename Real> void six  (const Real r, const Real t, Real * const rgb, const bool w0 = false, const Sym sym = Sym::None);//red->yellow->green->teal->blue->magenta->red (for 6 fold symmetry)
 		template <typename Real> using func = void (*)(const Real, const Real, Real * const, const bool, const Sym);//typedef color function signature for convince
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void four (const Real r, const Real t, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+		template <typename Real> void six  (const Real r, const Real t, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+		template <typename Real> using pfunc = void (*)(const Real, const Real, Real * const, const bool, const Sym, const color::Profile<Real>&);//typedef color function signature for convince
+
+		//@brief      : same as above but for arrays of coordinates written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles, the table backend interpolates DiskLut::cached)
+		template <typename Real> void four (Real const * const r, Real const * const t, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void six  (Real const * const r, Real const * const t, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> using func8 = void (*)(Real const * const, Real const * const, uint8_t * const, const size_t, const bool, const Sym, const bool, const color::Profile<Real>&, const Backend);//typedef color function signature for convince
 	}
 
 	namespace sphere {
@@ -103,6 +354,22 @@ namespace colormap {
 		template <typename Real> void four (const Real a, const Real p, Real * const rgb, const bool w0 = false, const Sym sym = Sym::None);//red->yellow->green      ->blue         ->red (for 4 fold symmetry)
 		template <typename Real> void six  (const Real a, const Real p, Real * const rgb, const bool w0 = false, const Sym sym = Sym::None);//red->yellow->green->teal->blue->magenta->red (for 6 fold symmetry)
 		template <typename Real> using func = void (*)(const Real, const Real, Real * const, const bool, const Sym);//typedef color function signature for convince
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void four (const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+		template <typename Real> void six  (const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+		template <typename Real> using pfunc = void (*)(const Real, const Real, Real * const, const bool, const Sym, const color::Profile<Real>&);//typedef color function signature for convince
+
+		//@brief      : same as above but for arrays of coordinates written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles, the table backend interpolates SphereLut::cached)
+		template <typename Real> void four (Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void six  (Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> using func8 = void (*)(Real const * const, Real const * const, uint8_t * const, const size_t, const bool, const Sym, const bool, const color::Profile<Real>&, const Backend);//typedef color function signature for convince
 	}
 
 	namespace ball {
@@ -116,8 +383,401 @@ namespace colormap {
 		template <typename Real> void four (const Real r, const Real a, const Real p, Real * const rgb, const bool w0 = false, const Sym sym = Sym::None);//red->yellow->green      ->blue         ->red (for 4 fold symmetry)
 		template <typename Real> void six  (const Real r, const Real a, const Real p, Real * const rgb, const bool w0 = false, const Sym sym = Sym::None);//red->yellow->green->teal->blue->magenta->red (for 6 fold symmetry)
 		template <typename Real> using func = void (*)(const Real, const Real, const Real, Real * const, const bool, const Sym);//typedef color function signature for convince
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void four (const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+		template <typename Real> void six  (const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+		template <typename Real> using pfunc = void (*)(const Real, const Real, const Real, Real * const, const bool, const Sym, const color::Profile<Real>&);//typedef color function signature for convince
+
+		//@brief      : same as above but for arrays of coordinates written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles, the table backend interpolates BallLut::cached)
+		template <typename Real> void four (Real const * const r, Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> void six  (Real const * const r, Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be = Backend::Float);
+		template <typename Real> using func8 = void (*)(Real const * const, Real const * const, Real const * const, uint8_t * const, const size_t, const bool, const Sym, const bool, const color::Profile<Real>&, const Backend);//typedef color function signature for convince
 	}
 
+	//@brief: disk color map baked into a polar table over (r, theta) with its center color and symmetry fixed (a bilinear interpolation per color)
+	template <typename Real>
+	class DiskLut {
+		public:
+			static const size_t DefaultRadii  = 129;//default number of radii   (r == 0 and r == 1 are both entries)
+			static const size_t DefaultAngles = 512;//default number of angles (theta == 1 wraps back to theta == 0)
+			static const size_t ErrorGrid     =  16;//cells with large errors are refined on an ErrorGrid x ErrorGrid grid to find maxDeltaE
+
+			//@brief     : bake a disk color map
+			//@param map : color map function to bake
+			//@param w0  : true/false for white/black @ r == 0
+			//@param sym : type of inversion symmetry
+			//@param prof: rgb color space to write colors in
+			//@param nr  : number of radii (at least 2)
+			//@param nt  : number of angles (at least 2)
+			DiskLut(disk::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof = color::Profile<Real>::sRGB(), const size_t nr = DefaultRadii, const size_t nt = DefaultAngles);
+
+			//@brief     : get a table for a disk color map, baking it on first use (thread safe)
+			//@param map : color map function to bake
+			//@param w0  : true/false for white/black @ r == 0
+			//@param sym : type of inversion symmetry
+			//@param prof: rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+			//@return    : cached table with the default size
+			static const DiskLut& cached(disk::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+
+			//@brief    : get the color at a polar coordinate
+			//@param r  : radius [0,1] (clamped, nan is treated as 0)
+			//@param t  : theta [0,1] (wrapped, nan is treated as 0)
+			//@param rgb: location to write rgb color [0,1]
+			void operator()(const Real r, const Real t, Real * const rgb) const;
+
+			//@brief    : get the 8 bit color at a polar coordinate
+			//@param r  : radius [0,1] (clamped, nan is treated as 0)
+			//@param t  : theta [0,1] (wrapped, nan is treated as 0)
+			//@param rgb: location to write rgb color [0,255]
+			void operator()(const Real r, const Real t, uint8_t * const rgb) const;
+
+			//@brief      : get 8 bit colors for arrays of polar coordinates
+			//@param r    : radii [0,1]
+			//@param t    : thetas [0,1]
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of coordinates
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			void operator()(Real const * const r, Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha = false) const;
+
+			//@brief : get the largest interpolation error of the table
+			//@return: maximum Delta E*uv between interpolated and exact colors at cell centers and edge midpoints, refined on a fine grid in the worst cells
+			Real maxDeltaE() const {return dE;}
+
+			//@brief : get the number of radii in the table
+			//@return: number of radii
+			size_t radii() const {return nRad;}
+
+			//@brief : get the number of angles in the table
+			//@return: number of angles
+			size_t angles() const {return nAng;}
+
+		private:
+			std::vector<Real> tbl ;//interleaved table entries (theta varies fastest)
+			size_t            nRad;//number of radii
+			size_t            nAng;//number of angles
+			Real              dE  ;//maximum interpolation error
+	};
+
+	//@brief: sphere color map baked into a cube map with its center color and symmetry fixed (a face selection and a bilinear interpolation per color)
+	//@note : inversion symmetric maps (Sym::Azimuth and Sym::Polar) only store the 3 positive faces and fold directions onto them, so v and -v always get the same color
+	//        the predefined maps pass their first coordinate to the bicone as the polar angle (as sphere::legend does), the coordinate overloads
+	//        below take their arguments in the same order as the baked map so they can stand in for it
+	template <typename Real>
+	class SphereLut {
+		public:
+			static const size_t DefaultSize = 129;//default number of texels along each face edge (the edges are shared by neighboring faces)
+			static const size_t ErrorGrid   =  16;//texels with large errors are refined on an ErrorGrid x ErrorGrid grid to find maxDeltaE
+
+			//@brief     : bake a sphere color map
+			//@param map : color map function to bake
+			//@param w0  : true/false for white/black @ north pole
+			//@param sym : type of inversion symmetry
+			//@param prof: rgb color space to write colors in
+			//@param n   : number of texels along each face edge (at least 2)
+			SphereLut(sphere::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof = color::Profile<Real>::sRGB(), const size_t n = DefaultSize);
+
+			//@brief     : get a table for a sphere color map, baking it on first use (thread safe)
+			//@param map : color map function to bake
+			//@param w0  : true/false for white/black @ north pole
+			//@param sym : type of inversion symmetry
+			//@param prof: rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+			//@return    : cached table with the default size
+			static const SphereLut& cached(sphere::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+
+			//@brief    : get the color of a direction
+			//@param v  : direction (x, y, z), doesn't need to be normalized (nan and 0 are treated as a direction on a face edge)
+			//@param rgb: location to write rgb color [0,1]
+			void operator()(Real const * const v, Real * const rgb) const;
+
+			//@brief    : get the color at a fractional spherical coordinate
+			//@param p  : phi [0, 1] (polar angle 0->north pole, 0.5->equator, 1-> south pole)
+			//@param a  : theta [0, 1] (azimuthal angle)
+			//@param rgb: location to write rgb color [0,1]
+			void operator()(const Real p, const Real a, Real * const rgb) const;
+
+			//@brief      : get 8 bit colors for an array of directions
+			//@param v    : directions (n * 3 interleaved)
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of directions
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			void operator()(Real const * const v, uint8_t * const rgb, const size_t n, const bool alpha = false) const;
+
+			//@brief      : get 8 bit colors for arrays of fractional spherical coordinates
+			//@param p    : phis [0,1]
+			//@param a    : thetas [0,1]
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of coordinates
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			void operator()(Real const * const p, Real const * const a, uint8_t * const rgb, const size_t n, const bool alpha = false) const;
+
+			//@brief : get the largest interpolation error of the table
+			//@return: maximum Delta E*uv between interpolated and exact colors at texel centers and edge midpoints, refined on a fine grid in the worst texels (peaks between grid points are bounded from the slopes around them)
+			Real maxDeltaE() const {return dE;}
+
+			//@brief : get the number of texels along each face edge
+			//@return: face size
+			size_t size() const {return num;}
+
+			//@brief : get the number of stored faces
+			//@return: 3/6 for inversion symmetric / general maps
+			size_t faces() const {return nFace;}
+
+		private:
+			//@brief    : find the face and face coordinates of a direction
+			//@param v  : direction
+			//@param f  : location to write face index (2 * axis + 1 for negative faces)
+			//@param u  : location to write first  face coordinate [-1,1]
+			//@param w  : location to write second face coordinate [-1,1]
+			void project(Real const * const v, size_t& f, Real& u, Real& w) const;
+
+			//@brief    : convert face coordinates back to fractional spherical coordinates
+			//@param f  : face index
+			//@param u  : first  face coordinate
+			//@param w  : second face coordinate
+			//@param p  : location to write phi [0,1]
+			//@param a  : location to write theta [0,1]
+			static void unproject(const size_t f, const Real u, const Real w, Real& p, Real& a);
+
+			//@brief    : interpolate a color from a face
+			//@param f  : face index (of a stored face)
+			//@param u  : first  face coordinate [-1,1]
+			//@param w  : second face coordinate [-1,1]
+			//@param rgb: location to write rgb color
+			void sample(const size_t f, const Real u, const Real w, Real * const rgb) const;
+
+			std::vector<Real> tbl  ;//interleaved texels, [face][w][u]
+			size_t            num  ;//texels along each face edge
+			size_t            nFace;//number of stored faces
+			Real              dE   ;//maximum interpolation error
+	};
+
+	//@brief: ball color map baked into a spherical voxel table over (r, theta, phi) with its center color and symmetry fixed (a trilinear interpolation per color)
+	template <typename Real>
+	class BallLut {
+		public:
+			static const size_t DefaultRadii    =  25;//default number of radii    (r   == 0 and r   == 1 are both entries)
+			static const size_t DefaultAzimuths = 128;//default number of azimuths (theta == 1 wraps back to theta == 0)
+			static const size_t DefaultPolars   =  97;//default number of polars   (phi == 0 and phi == 1 are both entries)
+			static const size_t ErrorGrid       =   4;//voxels with large errors are refined on an ErrorGrid^3 grid to find maxDeltaE
+
+			//@brief     : bake a ball color map
+			//@param map : color map function to bake
+			//@param w0  : true/false for white/black @ north pole
+			//@param sym : type of inversion symmetry
+			//@param prof: rgb color space to write colors in
+			//@param nr  : number of radii (at least 2)
+			//@param na  : number of azimuthal angles (at least 2)
+			//@param np  : number of polar angles (at least 2)
+			//@note      : the interpolation error falls roughly with the square of the table size in each direction (see maxDeltaE)
+			BallLut(ball::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof = color::Profile<Real>::sRGB(), const size_t nr = DefaultRadii, const size_t na = DefaultAzimuths, const size_t np = DefaultPolars);
+
+			//@brief     : get a table for a ball color map, baking it on first use (thread safe)
+			//@param map : color map function to bake
+			//@param w0  : true/false for white/black @ north pole
+			//@param sym : type of inversion symmetry
+			//@param prof: rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+			//@return    : cached table with the default size
+			static const BallLut& cached(ball::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof);
+
+			//@brief    : get the color at a fractional spherical coordinate
+			//@param r  : radius [0,1] (clamped, nan is treated as 0)
+			//@param a  : theta [0,1] (wrapped, nan is treated as 0)
+			//@param p  : phi [0,1] (clamped, nan is treated as 0)
+			//@param rgb: location to write rgb color [0,1]
+			void operator()(const Real r, const Real a, const Real p, Real * const rgb) const;
+
+			//@brief      : get 8 bit colors for arrays of fractional spherical coordinates
+			//@param r    : radii [0,1]
+			//@param a    : thetas [0,1]
+			//@param p    : phis [0,1]
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of coordinates
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			void operator()(Real const * const r, Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool alpha = false) const;
+
+			//@brief : get the largest interpolation error of the table
+			//@return: maximum Delta E*uv between interpolated and exact colors at voxel centers, refined on a fine grid in the worst voxels
+			Real maxDeltaE() const {return dE;}
+
+			//@brief : get the number of radii in the table
+			//@return: number of radii
+			size_t radii() const {return nRad;}
+
+			//@brief : get the number of azimuthal angles in the table
+			//@return: number of azimuthal angles
+			size_t azimuths() const {return nAzi;}
+
+			//@brief : get the number of polar angles in the table
+			//@return: number of polar angles
+			size_t polars() const {return nPol;}
+
+		private:
+			std::vector<Real> tbl ;//interleaved table entries, [r][phi][theta]
+			size_t            nRad;//number of radii
+			size_t            nAzi;//number of azimuthal angles
+			size_t            nPol;//number of polar angles
+			Real              dE  ;//maximum interpolation error
+	};
+
+	////////////////////////////////////////////////////////////////
+	//                   Type Erased Color Maps                   //
+	////////////////////////////////////////////////////////////////
+
+	//@brief: settings bound into a color map handle when it is built
+	template <typename Real>
+	struct MapOptions {
+		color::Profile<Real> const * prof  = &color::Profile<Real>::sRGB();//rgb color space to write colors in (must outlive the handle)
+		bool                         alpha = false                        ;//true/false to write rgba (with alpha = 1 or 255) / rgb
+		bool                         w0    = false                        ;//true/false for white/black @ r == 0 (disk, sphere, and ball only)
+		Sym                          sym   = Sym::None                    ;//type of inversion symmetry (disk, sphere, and ball only)
+		Backend                      be    = Backend::Float               ;//arithmetic backend for 8 bit colors (Table also interpolates floating point colors for disk, sphere, and ball maps, Fixed only applies to predefined maps)
+	};
+
+	//@brief: a color map with its settings bound, evaluated a batch at a time (one virtual call per batch instead of an indirect call per value)
+	//@note : D is the number of coordinates per value (1 for ramps and cycles, 2 for disks and spheres, 3 for balls)
+	template <typename Real, size_t D>
+	class Colormap {
+		public:
+			virtual ~Colormap() {}
+
+			//@brief    : compute colors for a batch of coordinates
+			//@param x  : D arrays of n coordinates [0,1] in the order of the matching function (e.g. r, theta for disk::four or a, p for sphere::four)
+			//@param n  : number of values
+			//@param rgb: location to write n interleaved colors with channels() values each
+			void map(Real const * const * const x, const size_t n, uint8_t * const rgb) const {colors(x, n, rgb);}
+			void map(Real const * const * const x, const size_t n, Real    * const rgb) const {colors(x, n, rgb);}
+
+			//@brief    : same as above for ramps and cycles
+			//@param t  : n fractional positions [0,1]
+			//@param n  : number of values
+			//@param rgb: location to write n interleaved colors with channels() values each
+			void map(Real const * const t, const size_t n, uint8_t * const rgb) const {static_assert(1 == D, "a single coordinate array only applies to ramps and cycles"); colors(&t, n, rgb);}
+			void map(Real const * const t, const size_t n, Real    * const rgb) const {static_assert(1 == D, "a single coordinate array only applies to ramps and cycles"); colors(&t, n, rgb);}
+
+			//@brief : get the number of channels per color
+			//@return: 3/4 for rgb/rgba
+			size_t channels() const {return alpha ? 4 : 3;}
+
+		protected:
+			//@brief      : construct a handle
+			//@param alpha: true/false to write rgba / rgb
+			explicit Colormap(const bool alpha) : alpha(alpha) {}
+
+		private:
+			//@brief: actual batch implementations (same parameters as map)
+			virtual void colors(Real const * const * const x, const size_t n, uint8_t * const rgb) const = 0;
+			virtual void colors(Real const * const * const x, const size_t n, Real    * const rgb) const = 0;
+
+			bool alpha;//true/false to write rgba / rgb
+	};
+
+	//@brief: builds color map handles by name (one registry for each type of map)
+	template <typename Real, size_t D>
+	class Registry {
+		public:
+			typedef std::function<std::unique_ptr<const Colormap<Real, D> >(const MapOptions<Real>&)> Factory;//function to build a handle from settings
+
+			//@brief : get the registry for a type of map (holding the predefined maps and anything added)
+			//@return: registry
+			static Registry& ramps  ();//D == 1
+			static Registry& cycles ();//D == 1
+			static Registry& disks  ();//D == 2
+			static Registry& spheres();//D == 2
+			static Registry& balls  ();//D == 3
+
+			//@brief        : add a color map (thread safe)
+			//@param name   : name to build map by (an existing map with the same name is replaced)
+			//@param factory: function to build a handle for the map
+			void add(const std::string& name, Factory factory);
+
+			//@brief     : build a handle by name (thread safe)
+			//@param name: name of map (e.g. "fire" or "l08")
+			//@param opts: settings to bind into the handle
+			//@return    : handle (or NULL if there is no map with the name)
+			//@note      : throws std::invalid_argument if the map can't honor opts.be (Backend::Fixed for maps added by addLut or addBicone)
+			std::unique_ptr<const Colormap<Real, D> > make(const std::string& name, const MapOptions<Real>& opts = MapOptions<Real>()) const;
+
+			//@brief : get the names of all maps in the registry
+			//@return: names in the order they were added
+			std::vector<std::string> names() const;
+
+		private:
+			Registry() {}
+
+			mutable std::mutex                             mut    ;//lock for entries
+			std::vector<std::pair<std::string, Factory> > entries;//names and factories
+	};
+
+	//@brief     : add a run time ramp or cyclic map to the ramp or cyclic registry (selected by lut->cyclic())
+	//@param name: name to build map by
+	//@param lut : map to add (shared with the handles built from it)
+	//@note      : handles support Backend::Float and Backend::Table (the same as Float since there is no table), make throws std::invalid_argument for Backend::Fixed
+	template <typename Real> void addLut(const std::string& name, std::shared_ptr<const DynamicLut<Real> > lut);
+
+	//@brief       : add a run time bicone to the disk, sphere, and ball registries
+	//@param name  : name to build maps by
+	//@param bicone: bicone to add (shared with the handles built from it)
+	//@note        : handles support Backend::Float and Backend::Table (the same as Float since there is no table), make throws std::invalid_argument for Backend::Fixed
+	template <typename Real> void addBicone(const std::string& name, std::shared_ptr<const DynamicBicone<Real> > bicone);
+
+	////////////////////////////////////////////////////////////////
+	//                Statically Dispatched Batches               //
+	////////////////////////////////////////////////////////////////
+
+	//predefined maps as functor types so a batch loop can be instantiated for a single map (calls are resolved and inlined at compile time)
+	//each functor colors one coordinate tuple: void(const X& x, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof)
+	//where x is a scalar for ramps and cycles and indexable (e.g. std::array<Real, D>) for disks (r, theta), spheres (a, p), and balls (r, a, p)
+	namespace ramp {
+		template <typename Real> struct Gray ;
+		template <typename Real> struct Fire ;
+		template <typename Real> struct Ocean;
+		template <typename Real> struct Ice  ;
+		template <typename Real> struct Div  ;
+	}
+
+	namespace cyclic {
+		template <typename Real> struct Gray;
+		template <typename Real> struct Four;
+		template <typename Real> struct Six ;
+		template <typename Real> struct Div ;
+	}
+
+	namespace disk {
+		template <typename Real> struct Four;
+		template <typename Real> struct Six ;
+		template <typename Bicone> struct Adaptor;//disk functor for any bicone (e.g. a DynamicBicone)
+	}
+
+	namespace sphere {
+		template <typename Real> struct Four;
+		template <typename Real> struct Six ;
+		template <typename Bicone> struct Adaptor;//sphere functor for any bicone (e.g. a DynamicBicone)
+	}
+
+	namespace ball {
+		template <typename Real> struct Four;
+		template <typename Real> struct Six ;
+		template <typename Bicone> struct Adaptor;//ball functor for any bicone (e.g. a DynamicBicone)
+	}
+
+	//@brief      : color a range of coordinates with a map, symmetry, and center color fixed at compile time
+	//@param begin: iterator to first coordinate (tuple)
+	//@param end  : iterator past last coordinate (tuple)
+	//@param rgb  : location to write interleaved rgb colors (3 per coordinate)
+	//@param prof : rgb color space to write colors in
+	//@param map  : functor instance (only needed for stateful functors like the adaptors)
+	//@note       : e.g. colorize<disk::Four<double>, Sym::Azimuth, true>(rt.begin(), rt.end(), rgb) for a std::vector<std::array<double, 2> > rt
+	//              S and W0 are ignored by ramps and cycles, the bicone functors call the bicone's disk<S, W0>, sphere<S, W0>, or ball<S, W0> directly
+	template <typename Map, Sym S = Sym::None, bool W0 = false, typename Iter, typename Real>
+	void colorize(Iter begin, const Iter end, Real * rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB(), const Map& map = Map());
+
 	////////////////////////////////////////////////////////////////
 	//                     Legend Generation                      //
 	////////////////////////////////////////////////////////////////
@@ -211,6 +871,18 @@ namespace colormap {
 		//@param vFill  : value to use for background
 		//@param N      : number of sine waves from p = 0->1 and a = 0->0.5 (ignored for ripple = false)
 		template <typename Real> void legend(func<Real> ball, Real * const rgb, const bool w0, const Sym sym, const Real rRipple, const Real pRipple, const Real aRipple, const bool alpha = false, const size_t WH = 512, const Real vFill = 0, const size_t N = 64);
+
+		//@brief        : create an rgb or rgba legend by interpolating a baked ball color map
+		//@param lut    : baked color map to use (center color and symmetry are fixed by the table)
+		//@param rgb    : location to write legend image data
+		//@param rRipple: magnitude of ripple in radial direction
+		//@param pRipple: magnitude of ripple in polar direction
+		//@param aRipple: magnitude of ripple in azimuthal direction
+		//@param alpha  : true/false to include an alpha channel
+		//@param WH     : width/height/depth of color bar in pixels
+		//@param vFill  : value to use for background
+		//@param N      : number of sine waves from p = 0->1 and a = 0->0.5 (ignored for ripple = false)
+		template <typename Real> void legend(const BallLut<Real>& lut, Real * const rgb, const Real rRipple, const Real pRipple, const Real aRipple, const bool alpha = false, const size_t WH = 512, const Real vFill = 0, const size_t N = 64);
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -218,6 +890,56 @@ namespace colormap {
 	////////////////////////////////////////////////////////////////
 
 	namespace detail {
+		//@brief: Q16.16 fixed point number for Backend::Fixed
+		//@note : the map structs below are templated on their arithmetic type, instantiating them with Fixed gives an integer only pipeline
+		//        products and quotients use 64 bit intermediates so only the values themselves need to fall within +/-32768
+		class Fixed {
+			public:
+				static const int Bits = 16;//number of fractional bits
+
+				constexpr Fixed() : v(0) {}
+				template <typename I, typename std::enable_if<std::is_integral      <I>::value, int>::type = 0> constexpr Fixed(const I i) : v((int32_t)i * (int32_t(1) << Bits)) {}//integers are exact
+				template <typename F, typename std::enable_if<std::is_floating_point<F>::value, int>::type = 0> constexpr Fixed(const F x) : v(nearest(x * (int32_t(1) << Bits))) {}//round to nearest
+
+				//@brief : get the underlying integer
+				//@return: value * 2^Bits
+				constexpr int32_t raw() const {return v;}
+
+				//@brief: conversion to an index (floor, for non negative values)
+				constexpr explicit operator size_t() const {return (size_t)(v >> Bits);}
+
+				constexpr Fixed& operator+=(const Fixed& o) {v += o.v; return *this;}
+				constexpr Fixed& operator-=(const Fixed& o) {v -= o.v; return *this;}
+				constexpr Fixed& operator*=(const Fixed& o) {v = (int32_t)(((int64_t)v * o.v + (int64_t(1) << (Bits - 1))) >> Bits); return *this;}//round to nearest
+				constexpr Fixed& operator/=(const Fixed& o) {v = (int32_t)(((int64_t)v * (int64_t(1) << Bits)) / o.v); return *this;}
+
+				friend constexpr Fixed operator+(Fixed a, const Fixed& b) {return a += b;}
+				friend constexpr Fixed operator-(Fixed a, const Fixed& b) {return a -= b;}
+				friend constexpr Fixed operator*(Fixed a, const Fixed& b) {return a *= b;}
+				friend constexpr Fixed operator/(Fixed a, const Fixed& b) {return a /= b;}
+				friend constexpr Fixed operator-(Fixed a) {a.v = -a.v; return a;}
+				friend constexpr Fixed floor(Fixed a) {a.v &= ~((int32_t(1) << Bits) - 1); return a;}//round toward -infinity
+
+				friend constexpr bool operator< (const Fixed& a, const Fixed& b) {return a.v <  b.v;}
+				friend constexpr bool operator> (const Fixed& a, const Fixed& b) {return a.v >  b.v;}
+				friend constexpr bool operator<=(const Fixed& a, const Fixed& b) {return a.v <= b.v;}
+				friend constexpr bool operator>=(const Fixed& a, const Fixed& b) {return a.v >= b.v;}
+				friend constexpr bool operator==(const Fixed& a, const Fixed& b) {return a.v == b.v;}
+				friend constexpr bool operator!=(const Fixed& a, const Fixed& b) {return a.v != b.v;}
+
+			private:
+				//@brief  : round a floating point value to the nearest integer (std::floor isn't constexpr)
+				//@param x: value to round
+				//@return : floor(x + 0.5)
+				template <typename F> static constexpr int32_t nearest(const F x) {
+					const F y = x + F(0.5);
+					const int64_t i = (int64_t)y;//truncate toward 0
+					return (int32_t)(F(i) > y ? i - 1 : i);
+				}
+
+				int32_t v;//value * 2^Bits
+		};
+
 		template <size_t N, typename Real> struct UniformBicone;//helper struct to hold a uniform bicone color map
 		template <size_t N, typename Real> struct UniformLut   ;//helper struct to hold a uniform ramp or cyclic color map
 
@@ -244,34 +966,276 @@ namespace colormap {
 
 		template <typename Real, size_t N, size_t K, size_t D> struct UniformSpline;//helper struct to hold a Kth degree spline in D dimensions with N control points
 
+		//policy for parameters outside of [0,1] (or nan) in batched spline evaluation
+		enum class Bound {
+			Throw,//throw std::out_of_range before any values are computed
+			Clamp,//clamp to [0,1] (nan stays nan)
+			Wrap ,//wrap into [0,1) (for cyclic maps, nan stays nan)
+			Nan   //write nan coordinates (floating point only, std::invalid_argument otherwise)
+		};
+
+		//@brief  : get the value passed to the fused Luv -> 8 bit rgb kernel for a Luv coordinate
+		//@param x: Luv coordinate
+		//@return : x as a floating point value or as a raw Q16.16 integer for Fixed
+		template <typename Real> Real luvValue(const Real & x) {return x;}
+		inline int32_t luvValue(const Fixed& x) {return x.raw();}
+
+		//@brief      : compute Luv colors a block at a time and write them through the fused Luv -> 8 bit rgb kernel
+		//@param n    : number of colors to compute
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param luv  : function to compute m colors starting at i in Luv space, void(const size_t i, const size_t m, Real * const luv) with luv interleaved
+		//@note       : Real is the arithmetic type of the map (T or Fixed), Fixed colors go through the integer kernel
+		template <typename Real, typename T, typename LuvFunc> void writeRgb8(const size_t n, uint8_t * const rgb, const bool alpha, const color::Profile<T>& prof, LuvFunc luv) {
+			const size_t stride = alpha ? 4 : 3;
+			color::detail::Block<typename std::conditional<std::is_same<Real, Fixed>::value, int32_t, T>::type> blk;
+			Real c[color::detail::BatchSize * 3];
+			for(size_t i = 0; i < n; i += color::detail::BatchSize) {
+				blk.n = std::min(color::detail::BatchSize, n - i);
+				luv(i, blk.n, c);
+				for(size_t j = 0; j < blk.n; j++)
+					for(size_t k = 0; k < 3; k++) blk.c[k][j] = luvValue(c[3*j+k]);//transpose to planar block
+				prof.luv2rgb8(blk, rgb + stride * i, alpha);
+			}
+		}
+
+		//@brief: kernel for 256 entry 8 bit sRGB tables (the CET maps)
+		template <bool Cyclic>
+		struct TableMap {
+			//@brief  : find the entries bracketing a fractional position
+			//@param t: fractional position [0,1]
+			//@param i: location to write index of entry at or before t
+			//@param j: location to write index of entry after t (wrapped back to 0 for cycles)
+			//@param f: location to write fractional distance from i to j
+			template <typename Real> static void locate(const Real t, size_t& i, size_t& j, Real& f) {
+				const Real x = t * (Cyclic ? 256 : 255);
+				i = std::min((size_t)x, size_t(Cyclic ? 255 : 254));
+				f = x - Real(i);
+				j = Cyclic && 255 == i ? 0 : i + 1;
+			}
+
+			//@brief    : get the sRGB color at a fractional position
+			//@param lut: table to interpolate
+			//@param t  : fractional position [0,1]
+			//@param rgb: location to write rgb color [0,1]
+			template <typename Real> static void rgb(const std::array<uint8_t, 768>& lut, const Real t, Real * const rgb) {
+				if(!(t >= Real(0) && t <= Real(1))) throw std::out_of_range("color map parameter out of bounds [0,1]");
+				size_t i, j;
+				Real f;
+				locate(t, i, j, f);
+				for(size_t k = 0; k < 3; k++) rgb[k] = (Real(lut[3*i+k]) + Real(int(lut[3*j+k]) - int(lut[3*i+k])) * f) / 255;
+			}
+
+			//@brief     : get the color at a fractional position in an arbitrary rgb color space
+			//@param lut : table to interpolate
+			//@param t   : fractional position [0,1]
+			//@param rgb : location to write rgb color [0,1]
+			//@param prof: rgb color space to write colors in
+			template <typename Real> static void rgb(const std::array<uint8_t, 768>& lut, const Real t, Real * const rgb, const color::Profile<Real>& prof) {
+				TableMap::rgb(lut, t, rgb);
+				const color::Profile<Real>& srgb = color::Profile<Real>::sRGB();
+				if(prof != srgb) {//the tables are sRGB
+					srgb.rgb2luv(rgb, rgb);
+					prof.luv2rgb(rgb, rgb);
+				}
+			}
+
+			//@brief      : get 8 bit colors for an array of fractional positions
+			//@param lut  : table to interpolate
+			//@param t    : fractional positions [0,1]
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of positions
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			//@param prof : rgb color space to write colors in
+			//@param be   : arithmetic backend (Table is the same as Float since the map is already a table)
+			//@note       : sRGB colors are interpolated directly between the bytes of the table
+			template <typename Real> static void rgb8(const std::array<uint8_t, 768>& lut, Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {
+				if(std::any_of(t, t + n, [](const Real& v){return !(v >= Real(0) && v <= Real(1));})) throw std::out_of_range("color map parameter out of bounds [0,1]");
+				if(Backend::Fixed == be) return rgb8Fixed(lut, t, rgb, n, alpha, prof);
+				const size_t stride = alpha ? 4 : 3;
+				const bool srgb = prof == color::Profile<Real>::sRGB();
+				for(size_t m = 0; m < n; m++) {
+					uint8_t * const c = rgb + stride * m;
+					if(srgb) {
+						size_t i, j;
+						Real f;
+						locate(t[m], i, j, f);
+						for(size_t k = 0; k < 3; k++) c[k] = (uint8_t)(Real(lut[3*i+k]) + Real(int(lut[3*j+k]) - int(lut[3*i+k])) * f + Real(0.5));
+					} else {
+						Real v[3];
+						TableMap::rgb(lut, t[m], v, prof);
+						for(size_t k = 0; k < 3; k++) c[k] = (uint8_t)(v[k] * 255 + Real(0.5));
+					}
+					if(alpha) c[3] = 0xFF;
+				}
+			}
+
+		private:
+			//@brief      : integer only version of rgb8 (positions are converted to Q16.16 like the other fixed point maps)
+			//@note       : same parameters as rgb8 (already bounds checked)
+			//@note       : sRGB colors are interpolated between the bytes of the table, other profiles interpolate the Luv values of the entries and use the integer Luv -> rgb kernel
+			//              (converting the entries keeps the conversion out of the loop, interpolating in Luv instead of sRGB moves a few colors by 2)
+			template <typename Real> static void rgb8Fixed(const std::array<uint8_t, 768>& lut, Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof) {
+				const size_t stride = alpha ? 4 : 3;
+				const bool srgb = prof == color::Profile<Real>::sRGB();
+				std::array<int32_t, 768> const * const luv = srgb ? NULL : &luvTable(lut);
+				color::detail::Block<int32_t> blk;
+				for(size_t m = 0; m < n; m += color::detail::BatchSize) {
+					blk.n = std::min(color::detail::BatchSize, n - m);
+					for(size_t q = 0; q < blk.n; q++) {
+						const int64_t x = int64_t(Fixed(t[m+q]).raw()) * (Cyclic ? 256 : 255);//Q16 position in the table
+						const size_t i = std::min((size_t)(x >> 16), size_t(Cyclic ? 255 : 254));
+						const size_t j = Cyclic && 255 == i ? 0 : i + 1;
+						const int64_t f = x - (int64_t(i) << 16);//[0, 2^16]
+						if(srgb) {
+							uint8_t * const c = rgb + stride * (m + q);
+							for(size_t k = 0; k < 3; k++) c[k] = (uint8_t)((int64_t(lut[3*i+k]) * 65536 + (int64_t(lut[3*j+k]) - lut[3*i+k]) * f + 32768) >> 16);//interpolate and round
+							if(alpha) c[3] = 0xFF;
+						} else {
+							for(size_t k = 0; k < 3; k++) blk.c[k][q] = (int32_t)((*luv)[3*i+k] + ((int64_t((*luv)[3*j+k]) - (*luv)[3*i+k]) * f >> 16));
+						}
+					}
+					if(!srgb) prof.luv2rgb8(blk, rgb + stride * m, alpha);
+				}
+			}
+
+			//@brief    : get the Luv values of a table's entries in Q16.16 (computed on first use for each table, thread safe)
+			//@param lut: sRGB table
+			//@return   : interleaved Luv values of the 256 entries
+			static const std::array<int32_t, 768>& luvTable(const std::array<uint8_t, 768>& lut) {
+				struct Entry {
+					std::array<uint8_t, 768> const *                 lut;
+					std::unique_ptr<const std::array<int32_t, 768> > luv;
+				};
+				static std::mutex         mut  ;
+				static std::vector<Entry> cache;//the tables are static (cet_lut.hpp) so they're identified by address
+				std::lock_guard<std::mutex> lock(mut);
+				for(const Entry& e : cache) if(e.lut == &lut) return *e.luv;
+				std::unique_ptr<std::array<int32_t, 768> > luv(new std::array<int32_t, 768>());
+				for(size_t i = 0; i < 256; i++) {
+					double c[3] = {lut[3*i] / 255.0, lut[3*i+1] / 255.0, lut[3*i+2] / 255.0};
+					color::rgb2luv(c, c);
+					for(size_t k = 0; k < 3; k++) (*luv)[3*i+k] = (int32_t)std::lround(c[k] * 65536);
+				}
+				cache.push_back(Entry{&lut, std::move(luv)});
+				return *cache.back().luv;
+			}
+		};
+
+		//inverse arc length table for a UniformLut (built on first use, trivially destructible so maps can be constant initialized)
+		template <typename Real>
+		struct ArcLength {
+			static const size_t Samples = 4096;//number of chords used to measure the spline
+			static const size_t Size    = 1024;//number of intervals in the inverse table
+			constexpr ArcLength() : inv() {}
+			ArcLength(const ArcLength&) : inv() {}//copies build their own table on first use
+			std::once_flag               flag;//guard for lazy construction
+			std::array<Real, Size + 1> inv ;//spline parameter at Size+1 evenly spaced fractional arc lengths
+		};
+
+		//interpolation error of a SplineBicone hue table (measured on first use, trivially destructible so maps can be constant initialized)
+		template <typename Real>
+		struct HueError {
+			constexpr HueError() : dE() {}
+			HueError(const HueError&) : dE() {}//copies measure their own error on first use
+			std::once_flag flag;//guard for lazy measurement
+			Real           dE  ;//largest Delta E*uv between table and spline colors
+		};
+
 		template <size_t N, typename Real>
 		struct UniformLut : private UniformSpline<Real, N, 3, 3> {//ramps and cycles are just cubic splines in LUV
 			public:
 				//@brief        : construct a perceptually uniform linear color map from N colors
 				//@param corners: color for N points in Luv space (should be uniformly spaced in L*)
-				UniformLut(const UniformSpline<Real, N, 3, 3>& spline) : UniformSpline<Real, N, 3, 3>(spline) {}
+				constexpr UniformLut(const UniformSpline<Real, N, 3, 3>& spline) : UniformSpline<Real, N, 3, 3>(spline) {}
+
+				//@brief     : get the rgb value corresponding to a fractional position on the ramp
+				//@param t   : fractional position on ramp [0,1]
+				//@param rgb : location to write rgb color [0,1]
+				//@param prof: rgb color space to write colors in
+				void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {UniformSpline<Real, N, 3, 3>::interpolate(t, false, rgb); prof.luv2rgb(rgb, rgb);}
+
+				//@brief      : get 8 bit rgb values for an array of fractional positions on the ramp
+				//@param t    : fractional positions on ramp [0,1]
+				//@param rgb  : location to write n interleaved 8 bit colors
+				//@param n    : number of positions
+				//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+				//@param prof : rgb color space to write colors in
+				//@note       : positions and profile are always floating point (T), the map itself is evaluated with Real
+				template <typename T>
+				void operator()(T const * const t, uint8_t * const rgb, const size_t n, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const {
+					writeRgb8<Real>(n, rgb, alpha, prof, [this, t](const size_t i, const size_t m, Real * const luv){
+						Real tm[color::detail::BatchSize];
+						std::transform(t + i, t + i + m, tm, [](const T& v){return Real(v);});
+						this->interpolate(tm, m, false, luv, Bound::Throw);
+					});
+				}
+
+				//@brief     : get rgb values for n evenly spaced positions along the ramp (0 -> 1 inclusive)
+				//@param n   : number of positions
+				//@param rgb : location to write n interleaved colors
+				//@param prof: rgb color space to write colors in
+				void sweep(const size_t n, Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {UniformSpline<Real, N, 3, 3>::sweep(n, false, rgb); prof.luv2rgb(rgb, rgb, n, color::Layout::Interleaved);}
+
+				//@brief  : map a fractional perceptual distance along the ramp to the spline parameter
+				//@param u: fractional distance along ramp in Delta E*uv [0, 1]
+				//@return : position t along ramp such that the arc length in Luv from 0 -> t is u times the total
+				Real uniform(const Real u) const;
 
-				//@brief    : get the rgb value corresponding to a fractional position on the ramp
-				//@param t  : fractional position on ramp [0,1]
-				//@param rgb: location to write rgb color [0,1]
-				void operator()(const Real t, Real * const rgb) const {UniformSpline<Real, N, 3, 3>::interpolate(t, false, rgb);color::luv2rgb(rgb, rgb);}
+			private:
+				mutable ArcLength<Real> arc;//lazily built inverse arc length table
 		};
 
-		template <size_t N, typename Real>
-		struct UniformBicone {
+		//@brief  : check fractional angles up front so the per color loops can't throw (same as Bound::Throw for splines)
+		//@param x: angles to check
+		//@param n: number of angles
+		template <typename T>
+		void checkAngles(T const * const x, const size_t n) {
+			if(std::any_of(x, x + n, [](const T& v){return !(v >= T(0) && v <= T(1));})) throw std::out_of_range("spline parameter out of bounds [0,1]");
+		}
+
+		//@brief: perceptually uniform HSL like coloring around a closed equator spline (shared by the fixed size and run time bicones)
+		template <typename Real, typename Spline>
+		struct SplineBicone {
 			public:
-				//@brief        : perceptually uniform HSL like coloring with N colors specified around the equator
-				//@param corners: color for N points around equator (hue control points for lightness = 0.5)
-				//@param l0     : L* at tip of bottom cone pole (lightness = 0)
-				//@param l1     : L* at tip of top    cone pole (lightness = 1)
-				UniformBicone(Real const * const corners, const Real l0, const Real l1);
+				//@brief   : construct a bicone from its equator and pole lightness
+				//@param eq: cyclic spline through the equator colors in Luv space (hue control points for lightness = 0.5)
+				//@param l0: L* at tip of bottom cone pole (lightness = 0)
+				//@param lm: average L* of the equator
+				//@param l1: L* at tip of top    cone pole (lightness = 1)
+				//@note    : throws std::invalid_argument unless l0 < L* < l1 for the equator at every hue (otherwise the cones collapse or turn inside out)
+				constexpr SplineBicone(const Spline& eq, const Real l0, const Real lm, const Real l1) : minL(l0), midL(lm), maxL(l1), eqSpline(eq), hueTbl(hueTable(eq, l0, l1)), hueErr() {
+					for(size_t i = 0; i < HueSize; i++) {
+						const Real l = hueTbl[i * HueStride + Eq];
+						if(!(minL < l && l < maxL)) throw std::invalid_argument("bicone poles must bracket the equator lightness (l0 < L* < l1)");//also rejects nan
+					}
+				}
 
 				//@brief       : convert from surface of perceptually uniform HSL like space (fully saturated) to rgb
 				//@param h     : fractional hue [0,1]
 				//@param l     : fractional lightness [0,1]
 				//@param rgb   : location to write rgb color [0,1]
 				//@param mirror: true/false if colors should be smooth with/without a mirror plane at l = 0.5
-				void operator()(const Real h, const Real l, Real * const rgb, const bool mirror) const {hl2luv(h, l, rgb, mirror); color::luv2rgb(rgb, rgb);}//compute LUV coordinates and -> rgb
+				//@param prof  : rgb color space to write colors in
+				void operator()(const Real h, const Real l, Real * const rgb, const bool mirror, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {checkAngles(&h, 1); hl2luv(h, l, rgb, mirror); prof.luv2rgb(rgb, rgb);}//compute LUV coordinates and -> rgb
+
+				//@brief       : same as above but evaluating the equator spline at h instead of interpolating the hue table (reference for the table, much slower)
+				//@param h     : fractional hue [0,1]
+				//@param l     : fractional lightness [0,1]
+				//@param rgb   : location to write rgb color [0,1]
+				//@param mirror: true/false if colors should be smooth with/without a mirror plane at l = 0.5
+				//@param prof  : rgb color space to write colors in
+				void exact(const Real h, const Real l, Real * const rgb, const bool mirror, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {
+					checkAngles(&h, 1);
+					if(mirror) hl2luv<true, true, true>(h, l, rgb); else hl2luv<false, true, true>(h, l, rgb);
+					prof.luv2rgb(rgb, rgb);
+				}
+
+				//@brief : get the largest interpolation error of the hue table (measured on first use, thread safe)
+				//@return: maximum Delta E*uv between operator() and exact, measured in Luv on a fine grid of hues in every table interval and lightnesses for both mirror settings
+				//@note  : floating point only (the fixed point maps are checked against the floating point maps in 8 bit instead)
+				Real hueDeltaE() const;
 
 				//@brief       : convert from perceptually uniform HSL like space to rgb
 				//@param h     : fractional hue [0,1]
@@ -279,7 +1243,8 @@ namespace colormap {
 				//@param l     : fractional lightness [0,1]
 				//@param rgb   : location to write rgb color [0,1]
 				//@param mirror: true/false if colors should be smooth with/without a mirror plane at l = 0.5
-				void operator()(const Real h, const Real r, const Real l, Real * const rgb, const bool mirror) const;
+				//@param prof  : rgb color space to write colors in
+				void operator()(const Real h, const Real r, const Real l, Real * const rgb, const bool mirror, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
 
 				//@brief      : map from a 2D direction to a color (perceptually uniform in r and theta)
 				//@param r    : fractional radius [0,1]
@@ -287,38 +1252,384 @@ namespace colormap {
 				//@param rgb  : location to write rgb color
 				//@param w0   : true/false for white/black @ r == 0
 				//@param sym  : type of inversion symmetry
-				void disk(const Real r, const Real theta, Real * const rgb, const bool w0, const Sym sym) const;
+				//@param prof : rgb color space to write colors in
+				void disk(const Real r, const Real theta, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
 
 				//@brief    : map from a 3D unit direction to a color (perceptually uniform in polar and azimuthal angle)
 				//@param a  : fractional azimuthal angle [0,1]
 				//@param p  : fractional polar angle [0,1]
 				//@param rgb: location to write rgb color
-				//@param w0 : true/false for white/black @ phi = 0
-				//@param sym: type of inversion symmetry
-				void sphere(const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) const;
+				//@param w0  : true/false for white/black @ phi = 0
+				//@param sym : type of inversion symmetry
+				//@param prof: rgb color space to write colors in
+				void sphere(const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
 
 				//@brief    : map from a 3D direction to a color (perceptually uniform in polar and azimuthal angle)
 				//@param r  : fractional radius [0,1]
 				//@param a  : fractional azimuthal angle [0,1]
 				//@param p  : fractional polar angle [0,1]
 				//@param rgb: location to write rgb color
-				//@param w0 : true/false for white/black @ phi = 0
-				//@param sym: type of inversion symmetry
-				void ball(const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) const;
+				//@param w0  : true/false for white/black @ phi = 0
+				//@param sym : type of inversion symmetry
+				//@param prof: rgb color space to write colors in
+				void ball(const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
+
+				//@brief      : same as disk, sphere, and ball but for arrays of coordinates written directly to 8 bit rgb
+				//@param rgb  : location to write n interleaved 8 bit colors
+				//@param n    : number of colors to compute
+				//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+				//@note       : coordinates and profile are always floating point (T), the map itself is evaluated with Real
+				template <typename T> void disk  (T const * const r, T const * const theta,                  uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const;
+				template <typename T> void sphere(T const * const a, T const * const p    ,                  uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const;
+				template <typename T> void ball  (T const * const r, T const * const a    , T const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const;
+
+				//@brief      : same as disk, sphere, and ball but with the symmetry and center color fixed at compile time (nothing per color branches on either)
+				//@template S : type of inversion symmetry
+				//@template W0: true/false for white/black center
+				//@note       : the runtime overloads above select one of these once per call (once per array for the 8 bit overloads)
+				template <Sym S, bool W0> void disk  (const Real r, const Real theta,               Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
+				template <Sym S, bool W0> void sphere(const Real a, const Real p    ,               Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
+				template <Sym S, bool W0> void ball  (const Real r, const Real a    , const Real p, Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const;
+				template <Sym S, bool W0, typename T> void disk  (T const * const r, T const * const theta,                  uint8_t * const rgb, const size_t n, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const;
+				template <Sym S, bool W0, typename T> void sphere(T const * const a, T const * const p    ,                  uint8_t * const rgb, const size_t n, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const;
+				template <Sym S, bool W0, typename T> void ball  (T const * const r, T const * const a    , T const * const p, uint8_t * const rgb, const size_t n, const bool alpha = false, const color::Profile<T>& prof = color::Profile<T>::sRGB()) const;
 
 			private:
-				//@brief       : actual implementation of perceptually uniform bicone in Luv space
-				//@param h     : fractional hue [0,1]
-				//@param l     : fractional lightness [0,1]
-				//@param rgb   : location to write rgb color
+				//@brief: Luv space implementations of disk, sphere, and ball (same parameters with luv in place of rgb)
+				template <Sym S, bool W0> void diskLuv  (const Real r, const Real theta,               Real * const luv) const;
+				template <Sym S, bool W0> void sphereLuv(const Real a, const Real p    ,               Real * const luv) const;
+				template <Sym S, bool W0> void ballLuv  (const Real r, const Real a    , const Real p, Real * const luv) const;
+
+				//@brief          : actual implementation of perceptually uniform bicone in Luv space
+				//@template Mirror: true/false if colors should be smooth at equator with/without a mirror plane at l = 0.5
+				//@template Smooth: true/false if colors should be smooth at equator
+				//@template Exact : true/false to compute the per hue quantities for h directly / interpolate them from the hue table
+				//@param h        : fractional hue [0,1] (unchecked, the public entry points check their angles)
+				//@param l        : fractional lightness [0,1]
+				//@param luv      : location to write luv color
+				template <bool Mirror, bool Smooth, bool Exact = false> void hl2luv(const Real h, const Real l, Real * const luv) const;
+
+				//@brief       : same as above with the mirror plane selected at run time (always smooth)
 				//@param mirror: true/false if colors should be smooth at equator with/without a mirror plane at l = 0.5
-				//@param smooth: true/false if colors should be smooth at equator
-				void hl2luv(const Real h, const Real l, Real * const luv, const bool mirror, const bool smooth = true) const;
+				void hl2luv(const Real h, const Real l, Real * const luv, const bool mirror) const {if(mirror) hl2luv<true, true>(h, l, luv); else hl2luv<false, true>(h, l, luv);}
+
+				//everything in hl2luv except the final polynomial in lightness depends only on hue, so it is tabulated at evenly spaced hues and linearly interpolated
+				//each entry holds the equator color, the deltas from the equator to the poles (and their reciprocals), and the lightness profile coefficients
+				//for both cones without / with a mirror plane: {c1, d1, a2} below the equator and {c4, d4, a3} above
+				static const size_t HueSize   = 256;//number of hue intervals in the table (see hueDeltaE for the resulting error)
+				static const size_t HueStride = 19 ;//values per table entry
+				static const size_t HueGrid   = 16 ;//every hue interval is measured at HueGrid evenly spaced hues to find hueDeltaE
+				static const size_t LightGrid = 100;//and at LightGrid + 1 evenly spaced lightnesses (hitting the equator and both transitions at 0.5 -/+ Tl)
+				enum HueField : size_t {Eq = 0, DeltaS = 3, DeltaN = 4, InvS = 5, InvN = 6, South = 7, North = 13};//offset of each field within an entry (each cone has 2 sets of 3 coefficients)
+				typedef std::array<Real, (HueSize + 1) * HueStride> HueTable;//entries for HueSize + 1 hues (the last entry repeats the first)
+				static constexpr Real Tl = Real(0.1);//offset from equator to end of transition for C2 continiuity of L* [0,0.5] 0 -> true perceptually uniformity with visual discontinuity, 0.5 -> largest deviation from perceptually uniformity but spreads discontinuity over largest area
+
+				//@brief   : compute the per hue quantities of hl2luv for a single hue
+				//@param eq: cyclic spline through the equator colors
+				//@param l0: L* at tip of bottom cone pole
+				//@param l1: L* at tip of top    cone pole
+				//@param h : fractional hue [0,1]
+				//@param e : location to write HueStride values
+				static constexpr void hueEntry(const Spline& eq, const Real l0, const Real l1, const Real h, Real * const e);
+
+				//@brief   : tabulate the per hue quantities of hl2luv
+				//@param eq: cyclic spline through the equator colors
+				//@param l0: L* at tip of bottom cone pole
+				//@param l1: L* at tip of top    cone pole
+				//@return  : hue table
+				static constexpr HueTable hueTable(const Spline& eq, const Real l0, const Real l1);
+
+				const Real     minL, midL, maxL;//luminance of south pole, equator (average), and north pole
+				const Spline   eqSpline        ;//cubic spline to interpolate colors around equator
+				const HueTable hueTbl          ;//per hue equator color and lightness profile coefficients
+				mutable HueError<Real> hueErr  ;//lazily measured hue table error
+		};
+
+		//@brief        : compute the average lightness of the equator colors
+		//@param corners: equator colors in Luv space (n * 3)
+		//@param n      : number of colors
+		//@return       : mean L*
+		template <typename Real>
+		constexpr Real equatorL(Real const * const corners, const size_t n) {
+			Real mean(0);
+			for(size_t i = 0; i < n; i++) mean += corners[3*i];
+			return mean / Real(n);
+		}
 
-				const Real minL, midL, maxL;//luminance of south pole, equator (average), and north pole
-				const detail::UniformSpline<Real, (N+1)*3, 3, 3> eqSpline;//cubic spline to interpolate colors around equator
+		template <size_t N, typename Real>
+		struct UniformBicone : public SplineBicone<Real, UniformSpline<Real, (N+1)*3, 3, 3> > {
+			//@brief        : perceptually uniform HSL like coloring with N colors specified around the equator
+			//@param corners: color for N points around equator (hue control points for lightness = 0.5)
+			//@param l0     : L* at tip of bottom cone pole (lightness = 0)
+			//@param l1     : L* at tip of top    cone pole (lightness = 1)
+			constexpr UniformBicone(Real const * const corners, const Real l0, const Real l1);
 		};
 
+		////////////////////////////////////////////////////////////////
+		//                       Spline Kernels                       //
+		////////////////////////////////////////////////////////////////
+
+		//the kernels below are shared by fixed size (UniformSpline) and runtime sized (DynamicSpline) splines
+		//segment coefficients are the power basis coefficients of each polynomial segment laid out as [segment][power][dimension]
+
+		//@brief        : compute the power basis coefficients of every segment by running de Boor's algorithm on polynomials
+		//@param P      : control points (N * D)
+		//@param N      : number of control points
+		//@param clamped: true/false to use clamped/unclamped uniform knots
+		//@param coefs  : location to write coefficients of each segment in the local parameter [0, 1] ((N-K) * (K+1) * D)
+		template <typename Real, size_t K, size_t D>
+		constexpr void splineSegments(Real const * const P, const size_t N, const bool clamped, Real * const coefs) {
+			for(size_t s = K; s < N; s++) {//loop over segments (knot span s contains control points s-degree -> s)
+				//start with constant polynomials for each control point, work[point][dimension][power]
+				Real work[K+1][D][K+1] = {};
+				for(size_t j = 0; j <= K; j++)
+					for(size_t d = 0; d < D; d++) work[j][d][0] = P[(s-K+j) * D + d];
+
+				//recursively compute coefficients (de Boor's algorithm with weights linear in the local parameter x)
+				for(size_t k = 0; k <= K; k++) {
+					for(size_t i = s; i > s+k-K; i--) {
+						const size_t iKk = std::min<size_t>(i+K-k, N);
+						const size_t ui = i > K ? i - K : 0;//knots[i] for clamped knots
+						const size_t uiKk = iKk > K ? iKk - K : 0;//knots[iKk] for clamped knots
+						const Real den = clamped ? Real(uiKk - ui) : Real(K - k);
+						const Real a = (clamped ? Real(s - K - ui) : Real(s - i)) / den;//weight = a + b * x
+						const Real b = Real(1) / den;
+						Real (&cur)[D][K+1] = work[i+K-s];
+						Real (&prv)[D][K+1] = work[i+K-s-1];
+						for(size_t d = 0; d < D; d++) {
+							for(size_t p = K; p > 0; p--) cur[d][p] = cur[d][p] * a + cur[d][p-1] * b + prv[d][p] * (Real(1) - a) - prv[d][p-1] * b;
+							cur[d][0] = cur[d][0] * a + prv[d][0] * (Real(1) - a);
+						}
+					}
+				}
+
+				//save coefficients of final polynomial
+				for(size_t p = 0; p <= K; p++)
+					for(size_t d = 0; d < D; d++) coefs[((s-K) * (K+1) + p) * D + d] = work[K][d][p];
+			}
+		}
+
+		//@brief   : evaluate a single segment polynomial with Horner's method
+		//@param c : coefficients of the segment
+		//@param x : local parameter within segment [0, 1]
+		//@param pt: location to write interpolated coordinates
+		template <typename Real, size_t K, size_t D>
+		constexpr void splineEvaluate(Real const * const c, const Real x, Real * const pt) {
+			for(size_t d = 0; d < D; d++) pt[d] = c[K * D + d];//std::copy and std::transform aren't constexpr
+			for(size_t k = K; k-- > 0; )
+				for(size_t d = 0; d < D; d++) pt[d] = pt[d] * x + c[k * D + d];
+		}
+
+		//@brief      : interpolate coordinates without checking the parameter
+		//@param coefs: segment coefficients
+		//@param S    : number of segments
+		//@param t    : parametric distance along spline, must be in [0, 1]
+		//@param pt   : location to write interpolated coordinates
+		template <typename Real, size_t K, size_t D>
+		constexpr void splineInterpolate(Real const * const coefs, const size_t S, const Real t, Real * const pt) {
+			//remap t to knot domain and find segment t falls in
+			const Real tt = t * S;
+			const size_t s = std::min((size_t)tt, S - 1);
+			splineEvaluate<Real, K, D>(coefs + s * (K+1) * D, tt - s, pt);
+		}
+
+		//@brief      : interpolate coordinates for an array of parameters
+		//@param coefs: segment coefficients
+		//@param S    : number of segments
+		//@param t    : parametric distances along spline
+		//@param n    : number of parameters
+		//@param pt   : location to write interpolated coordinates (n * D interleaved)
+		//@param bnd  : how to treat parameters outside of [0, 1] (and nan)
+		template <typename Real, size_t K, size_t D>
+		void splineInterpolate(Real const * const coefs, const size_t S, Real const * const t, const size_t n, Real * const pt, const Bound bnd) {
+			//types without a nan (e.g. Fixed where quiet_NaN() is 0) would silently write valid coordinates
+			if(Bound::Nan == bnd && !std::numeric_limits<Real>::has_quiet_NaN) throw std::invalid_argument("Bound::Nan requires a floating point spline");
+
+			//check all parameters up front so the evaluation loops can't throw
+			if(Bound::Throw == bnd) {
+				if(std::any_of(t, t + n, [](const Real& v){return !(v >= Real(0) && v <= Real(1));})) throw std::out_of_range("spline parameter out of bounds [0,1]");
+				for(size_t i = 0; i < n; i++) splineInterpolate<Real, K, D>(coefs, S, t[i], pt + i * D);
+				return;
+			}
+
+			//bring parameters into [0,1] and evaluate a block at a time
+			static const size_t B = 64;//block size
+			static const Real nan = std::numeric_limits<Real>::quiet_NaN();
+			Real tb[B];
+			for(size_t i = 0; i < n; i += B) {
+				const size_t m = std::min(B, n - i);
+				switch(bnd) {
+					case Bound::Throw:
+					case Bound::Clamp: std::transform(t + i, t + i + m, tb, [](const Real& v){return v < Real(0) ? Real(0) : v > Real(1) ? Real(1) : v;}); break;
+					case Bound::Wrap : std::transform(t + i, t + i + m, tb, [](const Real& v){using std::floor; return v - floor(v);}); break;
+					case Bound::Nan  : std::transform(t + i, t + i + m, tb, [](const Real& v){return v >= Real(0) && v <= Real(1) ? v : nan;}); break;
+				}
+				for(size_t j = 0; j < m; j++) {
+					Real * const p = pt + (i + j) * D;
+					if(tb[j] == tb[j]) splineInterpolate<Real, K, D>(coefs, S, tb[j], p);
+					else std::fill(p, p + D, nan);//nan in -> nan out
+				}
+			}
+		}
+
+		//@brief      : interpolate coordinates for n evenly spaced parameters (0 -> 1 inclusive) using forward differences
+		//@param coefs: segment coefficients
+		//@param S    : number of segments
+		//@param n    : number of parameters
+		//@param pt   : location to write interpolated coordinates (n * D interleaved)
+		template <typename Real, size_t K, size_t D>
+		void splineSweep(Real const * const coefs, const size_t S, const size_t n, Real * const pt) {
+			if(n < 2) {
+				if(1 == n) splineEvaluate<Real, K, D>(coefs, Real(0), pt);
+				return;
+			}
+
+			//tabulate forward differences of the monomials u^k at u = 0 with unit step (exact integers)
+			static const std::array<Real, (K+1)*(K+1)> T = [](){
+				std::array<Real, (K+1)*(K+1)> t;
+				for(size_t k = 0; k <= K; k++) {
+					long long v[K+1];
+					for(size_t i = 0; i <= K; i++) {
+						v[i] = 1;
+						for(size_t j = 0; j < k; j++) v[i] *= i;//i^k
+					}
+					for(size_t j = 1; j <= K; j++)
+						for(size_t i = K; i >= j; i--) v[i] -= v[i-1];//v[j] = jth difference at 0
+					for(size_t j = 0; j <= K; j++) t[j * (K+1) + k] = Real(v[j]);
+				}
+				return t;
+			}();
+
+			static const size_t R = 64;//maximum samples between re-seeds (bounds accumulated round off)
+			const size_t m = n - 1;//number of steps, sample i is at i * S / m in knot space
+			const Real h = Real(S) / m;//step size in local parameter
+			for(size_t s = 0; s < S; s++) {
+				//find the samples that fall in this segment (exact integer arithmetic so segments never overlap)
+				const size_t i0 = (s * m + S - 1) / S;
+				const size_t i1 = s + 1 == S ? n : ((s + 1) * m + S - 1) / S;
+				Real const * const c = coefs + s * (K+1) * D;
+				for(size_t i = i0; i < i1; i += R) {
+					const size_t iEnd = std::min(i + R, i1);
+					const Real x0 = Real(i * S - s * m) / m;//local parameter of first sample in chunk
+					if(iEnd <= i + K + 1) {//too few samples to be worth seeding differences
+						for(size_t j = i; j < iEnd; j++) splineEvaluate<Real, K, D>(c, x0 + h * (j - i), pt + j * D);
+						continue;
+					}
+
+					//seed forward differences analytically: shift the segment polynomial to x0, scale by h, and difference the monomials
+					Real diff[K+1][D];
+					for(size_t d = 0; d < D; d++) {
+						Real b[K+1];
+						for(size_t k = 0; k <= K; k++) b[k] = c[k * D + d];
+						for(size_t k = 0; k < K; k++)
+							for(size_t j = K - 1; j + 1 > k; j--) b[j] += b[j+1] * x0;//Taylor shift p(x) -> p(x0 + y)
+						Real hk(1);
+						for(size_t k = 0; k <= K; k++) {b[k] *= hk; hk *= h;}//p(x0 + h u) in powers of u
+						for(size_t j = 0; j <= K; j++) {
+							diff[j][d] = Real(0);
+							for(size_t k = j; k <= K; k++) diff[j][d] += b[k] * T[j * (K+1) + k];//jth difference of u^k vanishes for j > k
+						}
+					}
+
+					//step through chunk, each sample costs K additions per dimension
+					for(size_t j = i; j < iEnd; j++) {
+						std::copy(diff[0], diff[0] + D, pt + j * D);
+						for(size_t k = 0; k < K; k++)
+							for(size_t d = 0; d < D; d++) diff[k][d] += diff[k+1][d];
+					}
+				}
+			}
+		}
+
+		//@brief     : subdivide the sides of a closed control polygon to accommodate degree and wrap the ends to make a cyclic spline
+		//@param pts : control polygon (N * D)
+		//@param N   : number of points in polygon
+		//@param loop: location to write (N+1) * K control points
+		template <typename Real, size_t K, size_t D>
+		constexpr void loopPoints(Real const * const pts, const size_t N, Real * const loop) {
+			//rotate control points so t = 0 is at (odd degree) or closely aligned with (even degree) first control point and copy first degree control points to the end to make cyclic
+			const size_t R = N * K * D;//number of interpolated values
+			const size_t r = R - D * ((K-1)/2);//index of new first value
+			for(size_t i = 0; i < R; i++) {
+				const size_t v = (i + r) % R;//index of linearly interpolated value
+				const size_t p = v / (K * D), j = (v / D) % K, k = v % D;//polygon point, subdivision, and dimension
+				const Real w = Real(K - j) / K;//linear interpolation weight
+				loop[i] = pts[p * D + k] * w + pts[((p+1) % N) * D + k] * (Real(1) - w);
+			}
+			for(size_t i = 0; i < K * D; i++) loop[R + i] = loop[i];
+		}
+
+		//@brief       : pad control points so that f''(t) == 0 at the endpoints
+		//@param pts   : points to pad (N * D)
+		//@param N     : number of points
+		//@param padded: location to write N+2 padded points
+		template <typename Real, size_t D>
+		constexpr void padPoints(Real const * const pts, const size_t N, Real * const padded) {
+			for(size_t i = 0; i < N * D; i++) padded[D + i] = pts[i];
+			for(size_t i = 0; i < D; i++) {//reflect second and second to last points through the ends
+				padded[          i] = pts[          i] * 2 - pts[          D + i];
+				padded[(N+1)*D + i] = pts[(N-1)*D + i] * 2 - pts[(N-2)*D + i];
+			}
+		}
+
+		//@brief      : map a fractional perceptual distance along a Luv spline to the spline parameter
+		//@param arc  : inverse arc length table (built on first use)
+		//@param sweep: function to compute evenly spaced Luv samples (0 -> 1 inclusive), void(const size_t n, Real * const luv)
+		//@param u    : fractional distance along spline in Delta E*uv [0, 1]
+		//@return     : position t along spline such that the arc length in Luv from 0 -> t is u times the total
+		template <typename Real, typename Sweep>
+		Real arcParameter(ArcLength<Real>& arc, Sweep sweep, const Real u) {
+			if(!(u >= Real(0) && u <= Real(1))) throw std::out_of_range("arc length parameter out of bounds [0,1]");//also rejects nan
+			static const size_t M = ArcLength<Real>::Size;
+			std::call_once(arc.flag, [&arc, &sweep](){
+				//measure cumulative chord length (Delta E*uv) through evenly spaced samples
+				static const size_t S = ArcLength<Real>::Samples;
+				std::vector<Real> luv((S + 1) * 3), len(S + 1, Real(0));
+				sweep(S + 1, luv.data());
+				for(size_t i = 1; i <= S; i++) {
+					Real const * const p = luv.data() + 3 * i;
+					const Real dL = p[0] - p[-3], du = p[1] - p[-2], dv = p[2] - p[-1];
+					len[i] = len[i-1] + std::sqrt(dL * dL + du * du + dv * dv);
+				}
+
+				//invert by walking both tables once (arc length is monotonic in t)
+				size_t i = 0;
+				for(size_t j = 0; j <= M; j++) {
+					const Real target = len[S] * j / M;
+					while(i + 1 < S && len[i+1] < target) ++i;
+					const Real seg = len[i+1] - len[i];
+					const Real x = seg > Real(0) ? std::min(Real(1), std::max(Real(0), (target - len[i]) / seg)) : Real(0);
+					arc.inv[j] = (Real(i) + x) / S;
+				}
+				arc.inv[0] = Real(0);
+				arc.inv[M] = Real(1);
+			});
+
+			//linearly interpolate inverse table
+			const Real x = u * M;
+			const size_t j = std::min((size_t)x, M - 1);
+			return arc.inv[j] + (arc.inv[j+1] - arc.inv[j]) * (x - j);
+		}
+
+		//@brief       : get the inverse arc length table for a color map function without its own (built on first use)
+		//@param map   : color map function the table is for
+		//@param cyclic: true/false for a cyclic / ramp map
+		//@return      : cached table (filled in by the first arcParameter call)
+		template <typename Real>
+		ArcLength<Real>& arcTable(void (*map)(const Real, Real * const), const bool cyclic) {
+			struct Entry {
+				void (*map)(const Real, Real * const);
+				bool                             cyc;
+				std::unique_ptr<ArcLength<Real> > arc;
+			};
+			static std::mutex         mut  ;
+			static std::vector<Entry> cache;//only a handful of maps are ever used so a linear search is fine
+			std::lock_guard<std::mutex> lock(mut);
+			for(const Entry& e : cache) if(e.map == map && e.cyc == cyclic) return *e.arc;
+			cache.push_back(Entry{map, cyclic, std::unique_ptr<ArcLength<Real> >(new ArcLength<Real>())});
+			return *cache.back().arc;
+		}
+
 		////////////////////////////////////////////////////////////////
 		//               Uniform Spline Implementation                //
 		////////////////////////////////////////////////////////////////
@@ -327,88 +1638,134 @@ namespace colormap {
 			public:
 				//@brief    : construct a K degree B-spline from N control points in D dimensions
 				//@param pts: control points
-				UniformSpline(Real const * const pts);
+				constexpr UniformSpline(Real const * const pts);
 
-				//@brief        : interpolate coordinates using de Boor's algorithm for uniform knots
+				//@brief        : interpolate coordinates from the precomputed segment polynomials
 				//@param t      : parametric distance along spline [0, 1]
 				//@param clamped: true/false to use clamped/unclamped uniform knots
 				//@param pt     : location to write interpolated coordinates
-				void interpolate(const Real t, const bool clamped, Real * const pt) const;
+				void interpolate(const Real t, const bool clamped, Real * const pt) const {
+					if(t < Real(0) || t > Real(1)) throw std::out_of_range("spline parameter out of bounds [0,1]");
+					interpolateUnchecked(t, clamped, pt);
+				}
+
+				//@brief        : interpolate coordinates without checking the parameter
+				//@param t      : parametric distance along spline, must be in [0, 1]
+				//@param clamped: true/false to use clamped/unclamped uniform knots
+				//@param pt     : location to write interpolated coordinates
+				constexpr void interpolateUnchecked(const Real t, const bool clamped, Real * const pt) const {splineInterpolate<Real, K, D>((clamped ? Cc : C).data(), S, t, pt);}
+
+				//@brief        : interpolate coordinates for an array of parameters
+				//@param t      : parametric distances along spline
+				//@param n      : number of parameters
+				//@param clamped: true/false to use clamped/unclamped uniform knots
+				//@param pt     : location to write interpolated coordinates (n * D interleaved)
+				//@param bnd    : how to treat parameters outside of [0, 1] (and nan)
+				void interpolate(Real const * const t, const size_t n, const bool clamped, Real * const pt, const Bound bnd = Bound::Throw) const {splineInterpolate<Real, K, D>((clamped ? Cc : C).data(), S, t, n, pt, bnd);}
+
+				//@brief        : interpolate coordinates for n evenly spaced parameters (0 -> 1 inclusive) using forward differences
+				//@param n      : number of parameters
+				//@param clamped: true/false to use clamped/unclamped uniform knots
+				//@param pt     : location to write interpolated coordinates (n * D interleaved)
+				void sweep(const size_t n, const bool clamped, Real * const pt) const {splineSweep<Real, K, D>((clamped ? Cc : C).data(), S, n, pt);}
 
 			private:
+				static const size_t S = N - K;//number of polynomial segments
+				typedef std::array<Real, S * (K+1) * D> Coefs;//power basis coefficients of each segment, [segment][power][dimension]
+
 				std::array<Real, N*D> P;//control points
+				Coefs                 C;//segment coefficients for unclamped knots
+				Coefs                 Cc;//segment coefficients for clamped knots
 		};
 
-		//@brief    : construct a cyclic b-spline from a control polygon (sides will be subdivided to accommodate degree)
+		//@brief    : construct a K degree B-spline from N control points in D dimensions
 		//@param pts: control points
 		template<typename Real, size_t N, size_t K, size_t D>
-		UniformSpline<Real, N, K, D>::UniformSpline(Real const * const pts) {
-			static_assert(std::is_floating_point<Real>::value && K > 0 && K < N, "spline must be templated on floating point type with 1 <= degree < # pts");
-			std::copy(pts, pts + N * D, P.begin());
-		}
-
-		//@brief        : interpolate coordinates using de Boor's algorithm for uniform knots
-		//@param t      : parametric distance along spline [0, 1]
-		//@param clamped: true/false to use clamped/unclamped uniform knots
-		//@param pt     : location to write interpolated coordinates
-		template<typename Real, size_t N, size_t K, size_t D>
-		void UniformSpline<Real, N, K, D>::interpolate(const Real t, const bool clamped, Real * const pt) const {
-			//remap t to knot domain and find segment t falls in
-			if(t < Real(0) || t > Real(1)) throw std::out_of_range("spline parameter out of bounds [0,1]");
-			static const size_t uMax = N - K;//maximum knot value for clamped knots
-			const Real tt = clamped ? t * uMax : t * (N - K) + K;
-			const size_t s = std::min((clamped ? K : 0) + (size_t)tt, N - 1);
-
-			//copy control points to working array
-			Real work[(K+1) * D];
-			std::copy(P.begin() + (s-K) * D, P.begin() + (s+1) * D, work);//only points s-degree -> s (inclusive) are required
-
-			//recursively compute coordinates (de Boor's algorithm)
-			for(size_t k = 0; k <= K; k++) {
-				for(size_t i = s; i > s+k-K; i--) {
-					const size_t iKk = std::min<size_t>(i+K-k, N);
-					const size_t ui = i > K ? i - K : 0;//knots[i] for clamped knots
-					const size_t uiKk = iKk > K ? iKk - K : 0;//knots[iKk] for clamped knots
-					const Real w = clamped ? (tt - ui) / (uiKk - ui) : (tt - i) / (K - k) ;//compute weight
-					const Real x = Real(1) - w;//1 - weight
-					Real * const iter = work + (i+K-s) * D;//determine offset once
-					std::transform(iter, iter + D, iter - D, iter, [w, x](const Real& i, const Real& j) {return i * w + j * x;});//recursive calculation
-				}
-			}
-			std::copy(work + K * D, work + K * D + D, pt);
+		constexpr UniformSpline<Real, N, K, D>::UniformSpline(Real const * const pts) : P(), C(), Cc() {
+			static_assert((std::is_floating_point<Real>::value || std::is_same<Real, Fixed>::value) && K > 0 && K < N, "spline must be templated on floating point (or Fixed) type with 1 <= degree < # pts");
+			for(size_t i = 0; i < N * D; i++) P[i] = pts[i];//std::copy isn't constexpr
+			splineSegments<Real, K, D>(P.data(), N, false, C .data());
+			splineSegments<Real, K, D>(P.data(), N, true , Cc.data());
 		}
 
 		//@brief    : construct a cyclic b-spline from a control polygon by subdividing polygon sides to accommodate degree
 		//@param pts: control polygon (d * n)
 		template<typename Real, size_t N, size_t K, size_t D>
-		UniformSpline<Real, (N+1)*K, K, D> splineLoop(Real const * const pts) {
-			//compute linear interpolation weights once
-			std::array<Real, K> weights;
-			for(size_t i = 0; i < K; i++) weights[i] = Real(K - i) / K;
-
-			//linearly interpolate extra control points
-			std::array<Real, (N+1)*K * D> subPoints;
-			for(size_t i = 0; i < N; i++)//loop over original points
-				for(size_t j = 0; j < K; j++)//loop over degrees (split each segment into K segments)
-					for(size_t k = 0; k < D; k++)//loop over dimensions
-						subPoints[i * K * D + j * D + k] = pts[i * D + k] * weights[j] + pts[((i+1) % N) * D + k] * (Real(1) - weights[j]);
-			std::rotate(subPoints.begin(), subPoints.end() - D * ((K-1)/2) - K * D, subPoints.end() - K * D);//rotate control points so t = 0 is at (odd degree) or closely aligned with (even degree) first control point
-			std::copy(subPoints.begin(), subPoints.begin() + K * D, subPoints.end() - K * D);//copy first degree control points to the end to make cyclic
-			return UniformSpline<Real, (N+1)*K, K, D>(subPoints.data());
+		constexpr UniformSpline<Real, (N+1)*K, K, D> splineLoop(Real const * const pts) {
+			std::array<Real, (N+1)*K * D> loop{};
+			loopPoints<Real, K, D>(pts, N, loop.data());
+			return UniformSpline<Real, (N+1)*K, K, D>(loop.data());
 		}
 
 		//@brief    : pad control points to create splace with f''(t)==0 at endpoints
 		//@param pts: points to pad
 		//@return   : spline constructed from padded points
 		template <size_t N, typename Real, size_t K, size_t D>
-		detail::UniformSpline<Real, N + 2, K, D> paddedSpline(Real const * const pts) {
-			std::array<Real, (N+2) * D> padded;
-			std::copy(pts, pts + N * D, padded.begin() + D);
-			std::transform(pts, pts + D, pts + D, padded.begin(), [](const Real& v0, const Real& v1){return v0 * 2 - v1;});
-			std::transform(pts + (N-1) * D, pts + N * D, pts + (N-2) * D, padded.end() - D, [](const Real& v0, const Real& v1){return v0 * 2 - v1;});
+		constexpr detail::UniformSpline<Real, N + 2, K, D> paddedSpline(Real const * const pts) {
+			std::array<Real, (N+2) * D> padded{};
+			padPoints<Real, D>(pts, N, padded.data());
 			return detail::UniformSpline<Real, N + 2, K, D>(padded.data());
 		}
 
+		////////////////////////////////////////////////////////////////
+		//               Dynamic Spline Implementation                //
+		////////////////////////////////////////////////////////////////
+
+		//@brief: same as UniformSpline but with the number of control points chosen at run time (heap allocated)
+		template <typename Real, size_t K, size_t D> struct DynamicSpline {
+			public:
+				//@brief    : construct a K degree B-spline from n control points in D dimensions
+				//@param pts: control points (n * D)
+				//@param n  : number of control points (must be greater than K)
+				DynamicSpline(Real const * const pts, const size_t n);
+
+				//@brief: same as UniformSpline
+				void interpolate         (const Real t, const bool clamped, Real * const pt) const {
+					if(t < Real(0) || t > Real(1)) throw std::out_of_range("spline parameter out of bounds [0,1]");
+					interpolateUnchecked(t, clamped, pt);
+				}
+				void interpolateUnchecked(const Real t, const bool clamped, Real * const pt) const {splineInterpolate<Real, K, D>((clamped ? Cc : C).data(), S, t, pt);}
+				void interpolate         (Real const * const t, const size_t n, const bool clamped, Real * const pt, const Bound bnd = Bound::Throw) const {splineInterpolate<Real, K, D>((clamped ? Cc : C).data(), S, t, n, pt, bnd);}
+				void sweep               (const size_t n, const bool clamped, Real * const pt) const {splineSweep<Real, K, D>((clamped ? Cc : C).data(), S, n, pt);}
+
+				//@brief : get the control points
+				//@return: control points (size() * D)
+				Real const * points() const {return P.data();}
+
+				//@brief : get the number of control points
+				//@return: number of control points
+				size_t size() const {return P.size() / D;}
+
+			private:
+				size_t            S ;//number of polynomial segments
+				std::vector<Real> P ;//control points
+				std::vector<Real> C ;//segment coefficients for unclamped knots
+				std::vector<Real> Cc;//segment coefficients for clamped knots
+		};
+
+		//@brief    : construct a K degree B-spline from n control points in D dimensions
+		//@param pts: control points (n * D)
+		//@param n  : number of control points (must be greater than K)
+		template <typename Real, size_t K, size_t D>
+		DynamicSpline<Real, K, D>::DynamicSpline(Real const * const pts, const size_t n) : S(n > K ? n - K : 0), P(pts, pts + n * D), C(S * (K+1) * D), Cc(S * (K+1) * D) {
+			static_assert(std::is_floating_point<Real>::value && K > 0, "spline must be templated on floating point type with degree >= 1");
+			if(n <= K) throw std::invalid_argument("spline needs more control points than its degree");
+			splineSegments<Real, K, D>(P.data(), n, false, C .data());
+			splineSegments<Real, K, D>(P.data(), n, true , Cc.data());
+		}
+
+		////////////////////////////////////////////////////////////////
+		//                Uniform Lut Member Functions                //
+		////////////////////////////////////////////////////////////////
+
+		//@brief  : map a fractional perceptual distance along the ramp to the spline parameter
+		//@param u: fractional distance along ramp in Delta E*uv [0, 1]
+		//@return : position t along ramp such that the arc length in Luv from 0 -> t is u times the total
+		template <size_t N, typename Real>
+		Real UniformLut<N, Real>::uniform(const Real u) const {
+			return arcParameter(arc, [this](const size_t n, Real * const luv){UniformSpline<Real, N, 3, 3>::sweep(n, false, luv);}, u);
+		}
+
 		////////////////////////////////////////////////////////////////
 		//              Uniform Bicone Member Functions               //
 		////////////////////////////////////////////////////////////////
@@ -418,15 +1775,8 @@ namespace colormap {
 		//@param l0     : luminance of south pole (chromaticity = 0)
 		//@param l1     : luminance of north pole (chromaticity = 0)
 		template <size_t N, typename Real>
-		UniformBicone<N, Real>::UniformBicone(Real const * const corners, const Real l0, const Real l1) : 
-			minL(l0),
-			midL([](Real const * const c)->Real{
-				Real mean(0);
-				for(size_t i = 0; i < N; i++) mean += c[3*i];
-				return mean / N;
-			}(corners)),
-			maxL(l1),
-			eqSpline(detail::splineLoop<Real, N, 3, 3>(corners)) {}
+		constexpr UniformBicone<N, Real>::UniformBicone(Real const * const corners, const Real l0, const Real l1) : 
+			SplineBicone<Real, UniformSpline<Real, (N+1)*3, 3, 3> >(detail::splineLoop<Real, N, 3, 3>(corners), l0, equatorL(corners, N), l1) {}
 
 		//@brief       : convert from perceptually uniform HSL like space to rgb
 		//@param h     : fractional hue [0,1]
@@ -434,12 +1784,30 @@ namespace colormap {
 		//@param l     : fractional lightness [0,1]
 		//@param rgb   : location to write rgb color
 		//@param mirror: true/false if colors should be smooth with/without a mirror plane at l = 0.5
-		template <size_t N, typename Real>
-		void UniformBicone<N, Real>::operator()(const Real h, const Real r, const Real l, Real * const rgb, const bool mirror) const {
+		//@param prof  : rgb color space to write colors in
+		template <typename Real, typename Spline>
+		void SplineBicone<Real, Spline>::operator()(const Real h, const Real r, const Real l, Real * const rgb, const bool mirror, const color::Profile<Real>& prof) const {
+			checkAngles(&h, 1);
 			hl2luv(h, l, rgb, mirror);//compute LUV coordinates
 			rgb[0] = (rgb[0] - midL) * r + midL;//rescale L from midpoint (midL, 0, 0)
 			rgb[1] *= r; rgb[2] *= r;//rescale chromaticity from midpoint (midL, 0, 0)
-			color::luv2rgb(rgb, rgb);
+			prof.luv2rgb(rgb, rgb);
+		}
+
+		//@brief    : call a functor with the symmetry and center color as compile time constants
+		//@param w0 : true/false for white/black center
+		//@param sym: type of inversion symmetry
+		//@param f  : functor to call as f(std::integral_constant<Sym, S>(), std::integral_constant<bool, W0>())
+		template <typename F>
+		void dispatchSym(const bool w0, const Sym sym, F f) {
+			typedef std::integral_constant<Sym, Sym::None   > None   ;
+			typedef std::integral_constant<Sym, Sym::Azimuth> Azimuth;
+			typedef std::integral_constant<Sym, Sym::Polar  > Polar  ;
+			switch(sym) {
+				case Sym::None   : if(w0) f(None   (), std::true_type()); else f(None   (), std::false_type()); break;
+				case Sym::Azimuth: if(w0) f(Azimuth(), std::true_type()); else f(Azimuth(), std::false_type()); break;
+				case Sym::Polar  : if(w0) f(Polar  (), std::true_type()); else f(Polar  (), std::false_type()); break;
+			}
 		}
 
 		//@brief      : map from a 2D direction to a color (perceptually uniform in r and theta)
@@ -448,145 +1816,324 @@ namespace colormap {
 		//@param rgb  : location to write rgb color
 		//@param w0   : true/false for white/black @ r == 0
 		//@param sym  : type of inversion symmetry
-		template <size_t N, typename Real>
-		void UniformBicone<N, Real>::disk(const Real r, const Real theta, Real * const rgb, const bool w0, const Sym sym) const{// {hl2luv(inv ? (theta > Real(0.5) ? theta * 2 - 1 : theta * 2) : theta, w0 ? Real(1) - r / 2: r / 2, inv, inv);}
-			switch(sym) {
-				case Sym::None   : hl2luv(theta                                        , w0 ? Real(1) - r / 2 : r / 2, rgb, false, false); break;//select cone based on center color
-				case Sym::Azimuth: hl2luv(theta > Real(0.5) ? theta * 2 - 1 : theta * 2, w0 ? Real(1) - r / 2 : r / 2, rgb, true , true ); break;//double azimuthal angle and select cone based on center color
-				case Sym::Polar  : hl2luv(theta                                        , w0 ? Real(1) - r     : r    , rgb, false, true ); break;//double double polar angle
-			}
-			color::luv2rgb(rgb, rgb);//luv -> rgb
+		//@param prof : rgb color space to write colors in
+		template <typename Real, typename Spline>
+		void SplineBicone<Real, Spline>::disk(const Real r, const Real theta, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) const {
+			dispatchSym(w0, sym, [&](auto s, auto w){this->template disk<decltype(s)::value, decltype(w)::value>(r, theta, rgb, prof);});
 		}
 
 		//@brief    : map from a 3D unit direction to a color (perceptually uniform in polar and azimuthal angle)
 		//@param a  : fractional azimuthal angle [0,1]
 		//@param p  : fractional polar angle [0,1]
+		//@param rgb : location to write rgb color
+		//@param w0  : true/false for white/black @ phi = 0
+		//@param sym : type of inversion symmetry
+		//@param prof: rgb color space to write colors in
+		template <typename Real, typename Spline>
+		void SplineBicone<Real, Spline>::sphere(const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) const {
+			dispatchSym(w0, sym, [&](auto s, auto w){this->template sphere<decltype(s)::value, decltype(w)::value>(a, p, rgb, prof);});
+		}
+
+		//@brief    : map from a 3D direction to a color (perceptually uniform in polar and azimuthal angle)
+		//@param r  : fractional radius [0,1]
+		//@param a  : fractional azimuthal angle [0,1]
+		//@param p  : fractional polar angle [0,1]
 		//@param rgb: location to write rgb color
-		//@param w0 : true/false for white/black @ phi = 0
-		template <size_t N, typename Real>
-		void UniformBicone<N, Real>::sphere(const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) const {
+		//@param w0  : true/false for white/black @ phi = 0
+		//@param sym : type of inversion symmetry
+		//@param prof: rgb color space to write colors in
+		template <typename Real, typename Spline>
+		void SplineBicone<Real, Spline>::ball(const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) const {
+			dispatchSym(w0, sym, [&](auto s, auto w){this->template ball<decltype(s)::value, decltype(w)::value>(r, a, p, rgb, prof);});
+		}
+
+		//@brief      : same as disk, sphere, and ball but for arrays of coordinates written directly to 8 bit rgb
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		template <typename Real, typename Spline>
+		template <typename T>
+		void SplineBicone<Real, Spline>::disk(T const * const r, T const * const theta, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<T>& prof) const {
+			dispatchSym(w0, sym, [&](auto s, auto w){this->template disk<decltype(s)::value, decltype(w)::value>(r, theta, rgb, n, alpha, prof);});
+		}
+
+		template <typename Real, typename Spline>
+		template <typename T>
+		void SplineBicone<Real, Spline>::sphere(T const * const a, T const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<T>& prof) const {
+			dispatchSym(w0, sym, [&](auto s, auto w){this->template sphere<decltype(s)::value, decltype(w)::value>(a, p, rgb, n, alpha, prof);});
+		}
+
+		template <typename Real, typename Spline>
+		template <typename T>
+		void SplineBicone<Real, Spline>::ball(T const * const r, T const * const a, T const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<T>& prof) const {
+			dispatchSym(w0, sym, [&](auto s, auto w){this->template ball<decltype(s)::value, decltype(w)::value>(r, a, p, rgb, n, alpha, prof);});
+		}
+
+		//@brief      : map from a 2D direction to a color with the symmetry and center color fixed at compile time
+		//@template S : type of inversion symmetry
+		//@template W0: true/false for white/black @ r == 0
+		//@param r    : fractional radius [0,1]
+		//@param theta: fractional angle [0,1]
+		//@param rgb  : location to write rgb color
+		//@param prof : rgb color space to write colors in
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0>
+		void SplineBicone<Real, Spline>::disk(const Real r, const Real theta, Real * const rgb, const color::Profile<Real>& prof) const {
+			checkAngles(&theta, 1);
+			diskLuv<S, W0>(r, theta, rgb);
+			prof.luv2rgb(rgb, rgb);//luv -> rgb
+		}
+
+		//@brief      : map from a 3D unit direction to a color with the symmetry and center color fixed at compile time
+		//@template S : type of inversion symmetry
+		//@template W0: true/false for white/black @ phi = 0
+		//@param a    : fractional azimuthal angle [0,1]
+		//@param p    : fractional polar angle [0,1]
+		//@param rgb  : location to write rgb color
+		//@param prof : rgb color space to write colors in
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0>
+		void SplineBicone<Real, Spline>::sphere(const Real a, const Real p, Real * const rgb, const color::Profile<Real>& prof) const {
+			checkAngles(&a, 1);
+			sphereLuv<S, W0>(a, p, rgb);
+			prof.luv2rgb(rgb, rgb);//luv -> rgb
+		}
+
+		//@brief      : map from a 3D direction to a color with the symmetry and center color fixed at compile time
+		//@template S : type of inversion symmetry
+		//@template W0: true/false for white/black @ phi = 0
+		//@param r    : fractional radius [0,1]
+		//@param a    : fractional azimuthal angle [0,1]
+		//@param p    : fractional polar angle [0,1]
+		//@param rgb  : location to write rgb color
+		//@param prof : rgb color space to write colors in
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0>
+		void SplineBicone<Real, Spline>::ball(const Real r, const Real a, const Real p, Real * const rgb, const color::Profile<Real>& prof) const {
+			checkAngles(&a, 1);
+			ballLuv<S, W0>(r, a, p, rgb);
+			prof.luv2rgb(rgb, rgb);//luv -> rgb
+		}
+
+		//@brief      : same as disk, sphere, and ball with fixed symmetry and center color but for arrays of coordinates written directly to 8 bit rgb
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0, typename T>
+		void SplineBicone<Real, Spline>::disk(T const * const r, T const * const theta, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<T>& prof) const {
+			checkAngles(theta, n);
+			writeRgb8<Real>(n, rgb, alpha, prof, [&](const size_t i, const size_t m, Real * const luv){for(size_t j = 0; j < m; j++) diskLuv<S, W0>(Real(r[i+j]), Real(theta[i+j]), luv + 3 * j);});
+		}
+
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0, typename T>
+		void SplineBicone<Real, Spline>::sphere(T const * const a, T const * const p, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<T>& prof) const {
+			checkAngles(a, n);
+			writeRgb8<Real>(n, rgb, alpha, prof, [&](const size_t i, const size_t m, Real * const luv){for(size_t j = 0; j < m; j++) sphereLuv<S, W0>(Real(a[i+j]), Real(p[i+j]), luv + 3 * j);});
+		}
+
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0, typename T>
+		void SplineBicone<Real, Spline>::ball(T const * const r, T const * const a, T const * const p, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<T>& prof) const {
+			checkAngles(a, n);
+			writeRgb8<Real>(n, rgb, alpha, prof, [&](const size_t i, const size_t m, Real * const luv){for(size_t j = 0; j < m; j++) ballLuv<S, W0>(Real(r[i+j]), Real(a[i+j]), Real(p[i+j]), luv + 3 * j);});
+		}
+
+		//@brief      : map from a 2D direction to a color in Luv space (perceptually uniform in r and theta)
+		//@template S : type of inversion symmetry
+		//@template W0: true/false for white/black @ r == 0
+		//@param r    : fractional radius [0,1]
+		//@param theta: fractional angle [0,1]
+		//@param luv  : location to write luv color
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0>
+		void SplineBicone<Real, Spline>::diskLuv(const Real r, const Real theta, Real * const luv) const {
+			const Real l = Sym::Polar == S ? r : r / 2;//double polar angle
+			const Real t = Sym::Azimuth == S ? (theta > Real(0.5) ? theta * 2 - 1 : theta * 2) : theta;//double azimuthal angle
+			hl2luv<Sym::Azimuth == S, Sym::None != S>(t, W0 ? Real(1) - l : l, luv);//select cone based on center color
+		}
+
+		//@brief      : map from a 3D unit direction to a color in Luv space (perceptually uniform in polar and azimuthal angle)
+		//@template S : type of inversion symmetry
+		//@template W0: true/false for white/black @ phi = 0
+		//@param a    : fractional azimuthal angle [0,1]
+		//@param p    : fractional polar angle [0,1]
+		//@param luv  : location to write luv color
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0>
+		void SplineBicone<Real, Spline>::sphereLuv(const Real a, const Real p, Real * const luv) const {
 			//first move to northern hemisphere if needed
-			const bool sh = p > Real(0.5);
-			const bool swap = sh && Sym::None != sym;
+			const bool swap = Sym::None != S && p > Real(0.5);
 			const Real az = swap ? (a < Real(0.5) ? a + Real(0.5) : a - Real(0.5)) : a;
 			const Real pl = swap ? Real(1) - p : p;
 
 			//compute color in luv space
-			switch(sym) {
-				case Sym::None   : hl2luv(az                                  , w0 ? Real(1) - pl     : pl    , rgb, false, true); break;//select cone based on center color
-				case Sym::Azimuth: hl2luv(az < Real(0.5) ? az * 2 : az * 2 - 1, w0 ? Real(1) - pl     : pl    , rgb, true , true); break;//double azimuthal angle and select cone based on center color
-				case Sym::Polar  : hl2luv(az                                  , w0 ? Real(1) - pl * 2 : pl * 2, rgb, false, true); break;//double double polar angle
-			}
-			color::luv2rgb(rgb, rgb);//luv -> rgb
+			const Real l = Sym::Polar == S ? pl * 2 : pl;//double polar angle
+			const Real t = Sym::Azimuth == S ? (az < Real(0.5) ? az * 2 : az * 2 - 1) : az;//double azimuthal angle
+			hl2luv<Sym::Azimuth == S, true>(t, W0 ? Real(1) - l : l, luv);//select cone based on center color
 		}
 
-		//@brief    : map from a 3D direction to a color (perceptually uniform in polar and azimuthal angle)
-		//@param r  : fractional radius [0,1]
-		//@param a  : fractional azimuthal angle [0,1]
-		//@param p  : fractional polar angle [0,1]
-		//@param rgb: location to write rgb color
-		//@param w0 : true/false for white/black @ phi = 0
-		//@param sym: type of inversion symmetry
-		template <size_t N, typename Real>
-		void UniformBicone<N, Real>::ball(const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) const {
+		//@brief      : map from a 3D direction to a color in Luv space (perceptually uniform in polar and azimuthal angle)
+		//@template S : type of inversion symmetry
+		//@template W0: true/false for white/black @ phi = 0
+		//@param r    : fractional radius [0,1]
+		//@param a    : fractional azimuthal angle [0,1]
+		//@param p    : fractional polar angle [0,1]
+		//@param luv  : location to write luv color
+		template <typename Real, typename Spline>
+		template <Sym S, bool W0>
+		void SplineBicone<Real, Spline>::ballLuv(const Real r, const Real a, const Real p, Real * const luv) const {
 			//first move to northern hemisphere if needed
-			const bool sh = p > Real(0.5);
-			const bool swap = sh && Sym::None != sym;
+			const bool swap = Sym::None != S && p > Real(0.5);
 			const Real az = swap ? (a < Real(0.5) ? a + Real(0.5) : a - Real(0.5)) : a;
 			const Real pl = swap ? Real(1) - p : p;
 
 			//compute color in luv space
-			switch(sym) {
-				case Sym::None   : hl2luv(az                                  , w0 ? Real(1) - pl     : pl    , rgb, false, false); break;//select cone based on center color
-				case Sym::Azimuth: hl2luv(az < Real(0.5) ? az * 2 : az * 2 - 1, w0 ? Real(1) - pl     : pl    , rgb, true , true ); break;//double azimuthal angle and select cone based on center color
-				case Sym::Polar  : hl2luv(az                                  , w0 ? Real(1) - pl * 2 : pl * 2, rgb, false, true ); break;//double double polar angle
-			}
+			const Real l = Sym::Polar == S ? pl * 2 : pl;//double polar angle
+			const Real t = Sym::Azimuth == S ? (az < Real(0.5) ? az * 2 : az * 2 - 1) : az;//double azimuthal angle
+			hl2luv<Sym::Azimuth == S, Sym::None != S>(t, W0 ? Real(1) - l : l, luv);//select cone based on center color
 
 			//resacle color by radius
-			rgb[0] = (rgb[0] - midL) * r + midL;
-			rgb[1] *= r; rgb[2] *= r;
-			color::luv2rgb(rgb, rgb);//luv -> rgb
+			luv[0] = (luv[0] - midL) * r + midL;
+			luv[1] *= r; luv[2] *= r;
 		}
 
-		//@brief       : compute perceptually uniform HSL like color in Luv space
-		//@param h     : fractional hue [0,1]
-		//@param l     : fractional lightness [0,1]
-		//@param luv   : location to write luv color
-		//@param mirror: should colors be smooth with/without a mirror plane at l = 0.5
-		//@param smooth: true/false to make L* C1 continuous across equator (at expense of uniformity)
-		template <size_t N, typename Real>
-		void UniformBicone<N, Real>::hl2luv(const Real h, const Real l, Real * const luv, const bool mirror, const bool smooth) const {
-			//spline interpolate color at equator (L = 0.5) for this hue
-			eqSpline.interpolate(h, false, luv);
-
-			//apply nonlinear rescaling to lightness interpolation to impose C2 continuity at equator
-			//I'll use a piecewise polynomial with linear portions near the poles to maximize truly perceptually uniform region
-			//        / f1 =                       c1 * x + d1 : 0       <= x <= 1/2 - t (linear from pole to first transition)
-			// f(x) = | f2 = a2 * x^3 + b2 * x^2 + c2 * x + d2 : 1/2 - t <  x <= 1/2     (cubic from first transition to equator)
-			//        | f3 = a3 * x^3 + b3 * x^2 + c3 * x + d3 : 1/2     <  x <  1/2 + t (cubic from equator to second transition)
-			//        \ f4 =                       c4 * x + d4 : 1/2 + t <= x <= 1       (linear from second transition to pole)
-			//12 unknowns solved for with the following 12 constraints
-			//-C2 continuity between f1/f2, f2/f3, and f3, f4 (9 constraints)
-			//-f(0) = minL, f(1/2) = luv[0], f(1) = maxL (3 constraints)
-			static const Real tl = Real(0.1);//offset from equator to end of transition for C2 continiuity of L* [0,0.5] 0 -> true perceptually uniformity with visual discontinuity, 0.5 -> largest deviation from perceptually uniformity but spreads discontinuity over largest area
+		template <typename Real, typename Spline> constexpr Real SplineBicone<Real, Spline>::Tl;//Fixed arithmetic takes its operands by reference so c++14 needs a definition
+
+		//@brief : get the largest interpolation error of the hue table (measured on first use, thread safe)
+		//@return: maximum Delta E*uv between operator() and exact
+		template <typename Real, typename Spline>
+		Real SplineBicone<Real, Spline>::hueDeltaE() const {
+			std::call_once(hueErr.flag, [this](){
+				//the table is exact at its entries, so only the hues between them are measured
+				//(the error is smooth in lightness between the equator and transitions, which the lightness grid hits exactly)
+				Real dE(0);
+				for(size_t i = 0; i < HueSize; i++) {
+					for(size_t x = 1; x < HueGrid; x++) {
+						const Real h = (Real(i) + Real(x) / HueGrid) / HueSize;
+						for(size_t j = 0; j <= LightGrid; j++) {
+							const Real l = Real(j) / LightGrid;
+							Real tbl[3], exact[3];
+							for(size_t m = 0; m < 2; m++) {//without / with mirror plane
+								hl2luv(h, l, tbl, 1 == m);
+								if(m) hl2luv<true, true, true>(h, l, exact); else hl2luv<false, true, true>(h, l, exact);
+								Real d2(0);
+								for(size_t k = 0; k < 3; k++) d2 += (tbl[k] - exact[k]) * (tbl[k] - exact[k]);
+								dE = std::max(dE, std::sqrt(d2));
+							}
+						}
+					}
+				}
+				hueErr.dE = dE;
+			});
+			return hueErr.dE;
+		}
+
+		//@brief   : compute the per hue quantities of hl2luv for a single hue
+		//@param eq: cyclic spline through the equator colors
+		//@param l0: L* at tip of bottom cone pole
+		//@param l1: L* at tip of top    cone pole
+		//@param h : fractional hue [0,1]
+		//@param e : location to write HueStride values
+		template <typename Real, typename Spline>
+		constexpr void SplineBicone<Real, Spline>::hueEntry(const Spline& eq, const Real l0, const Real l1, const Real h, Real * const e) {
+			//the lightness profile is built from a piecewise polynomial with linear portions near the poles to maximize truly perceptually uniform region
+			//        / f1 = c1 * x + d1                         : 0       <= x <= 1/2 - t (linear from pole to first transition)
+			// f(x) = | f2 = c1 * x + d1 + a2 * (x - 1/2 + t)^3 : 1/2 - t <  x <= 1/2     (cubic from first transition to equator)
+			//        | f3 = c4 * x + d4 + a3 * (x - 1/2 - t)^3 : 1/2     <  x <  1/2 + t (cubic from equator to second transition)
+			//        \ f4 = c4 * x + d4                         : 1/2 + t <= x <= 1       (linear from second transition to pole)
+			//writing the cubics as the linear pieces plus a cube about the transitions makes f1/f2 and f3/f4 C2 continuous by construction
+			//the remaining 6 unknowns are solved for with C2 continuity between f2/f3 (3 constraints) and f(0) = minL, f(1/2) = equator L*, f(1) = maxL (3 constraints)
+			//the shifted form also keeps every intermediate small, which Q16.16 needs (expanded in powers of x the cubic coefficients are in the thousands)
+			eq.interpolateUnchecked(h, false, e + Eq);//spline interpolate color at equator (L = 0.5) for this hue
+			const Real deltaS = l0 - e[Eq];//delta luminance from equator to south pole
+			const Real deltaN = l1 - e[Eq];//delta luminance from equator to north pole
+			e[DeltaS] = deltaS;
+			e[DeltaN] = deltaN;
+			e[InvS  ] = Real(1) / deltaS;
+			e[InvN  ] = Real(1) / deltaN;
+			for(size_t m = 0; m < 2; m++) {//without / with mirror plane
+				//southern cone (with a mirror plane the northern cone is a reflection so both deltas are to the south pole)
+				Real * const c = e + South + 3 * m;
+				const Real lS0 = deltaS, lS1 = m ? deltaS : deltaN;//delta luminance at l == 0 and l == 1
+				const Real xS = ( lS0 + lS1 ) / ( Tl * 2 - 3 );
+				c[0] = (xS * Tl - lS0) * 2;//c1
+				c[1] = lS0;//d1
+				c[2] = -xS / Tl / Tl;//a2 (Tl * Tl only has ~3 significant digits in Q16.16)
+
+				//northern cone (with a mirror plane both deltas are to the north pole)
+				Real * const n = e + North + 3 * m;
+				const Real lN0 = m ? deltaN : deltaS, lN1 = deltaN;//delta luminance at l == 0 and l == 1
+				const Real xN = ( lN0 + lN1 ) / ( Tl * 2 - 3 );
+				n[0] = (lN1 - xN * Tl) * 2;//c4
+				n[1] = lN1 - n[0];//d4
+				n[2] = xN / Tl / Tl;//a3
+			}
+		}
+
+		//@brief   : tabulate the per hue quantities of hl2luv
+		//@param eq: cyclic spline through the equator colors
+		//@param l0: L* at tip of bottom cone pole
+		//@param l1: L* at tip of top    cone pole
+		//@return  : hue table
+		template <typename Real, typename Spline>
+		constexpr typename SplineBicone<Real, Spline>::HueTable SplineBicone<Real, Spline>::hueTable(const Spline& eq, const Real l0, const Real l1) {
+			HueTable tbl{};
+			for(size_t i = 0; i < HueSize; i++) hueEntry(eq, l0, l1, Real(i) / Real(HueSize), tbl.data() + i * HueStride);
+			for(size_t k = 0; k < HueStride; k++) tbl[HueSize * HueStride + k] = tbl[k];//close the loop
+			return tbl;
+		}
+
+		//@brief          : compute perceptually uniform HSL like color in Luv space
+		//@template Mirror: should colors be smooth with/without a mirror plane at l = 0.5
+		//@template Smooth: true/false to make L* C1 continuous across equator (at expense of uniformity)
+		//@template Exact : true/false to compute the per hue quantities for h directly / interpolate them from the hue table
+		//@param h        : fractional hue [0,1]
+		//@param l        : fractional lightness [0,1]
+		//@param luv      : location to write luv color
+		template <typename Real, typename Spline>
+		template <bool Mirror, bool Smooth, bool Exact>
+		void SplineBicone<Real, Spline>::hl2luv(const Real h, const Real l, Real * const luv) const {
+			//find the bracketing hues in the table (everything but the final polynomial is interpolated from the table)
+			Real entry[HueStride];
+			const Real x = h * Real(HueSize);
+			const size_t i = Exact ? 0 : std::min((size_t)x, HueSize - 1);
+			const Real f = Exact ? Real(0) : x - Real(i);
+			if(Exact) hueEntry(eqSpline, minL, maxL, h, entry);//evaluate the spline for this hue instead
+			Real const * const p = Exact ? entry : hueTbl.data() + i * HueStride;
+			Real const * const q = Exact ? entry : p + HueStride;
+			auto lerp = [p, q, f](const size_t k) {return p[k] + (q[k] - p[k]) * f;};
+
+			//interpolate color at equator (L = 0.5) for this hue
+			for(size_t k = 0; k < 3; k++) luv[k] = lerp(Eq + k);
+
+			//apply nonlinear rescaling to lightness interpolation to impose C2 continuity at equator (see hueTable for the profile)
 			const bool sh = l <= Real(0.5);//does this point fall below/above the equator (true/false)
-			const Real deltaS = minL - luv[0];//delta luminance from equator to south pole
-			const Real deltaN = maxL - luv[0];//delta luminance from equator to north pole
-			const Real l0 = sh ? deltaS : (mirror ? deltaN : deltaS);//delta luminance at l == 0
-			const Real l1 = sh ? (mirror ? deltaS : deltaN) : deltaN;//delta luminance at l == 1
 			Real deltaL;
-			if(smooth) {
-				const Real x = ( l0 + l1 ) / ( tl * 2 - 3 );//this value will be needed in all for segments
-				if(sh) {//in f1 or f2, don't bother calculating coefficients for f3 or f4
-					const Real hmt = Real(0.5) - tl;//transition from linear -> cubic in southern cone
-					const Real c1 = (x * tl - l0) * 2;//compute slope of linear region in southern cone
-					const Real d1 = l0;//compute intercept of linear region in southern cone
-					if(l <= hmt) {//in first linear region (f1)
-						deltaL = c1 * l + d1;//compute f1(l)
-					} else {//in first cubic region (f2)
-						const Real a2 = -x / (tl * tl);
-						const Real b2 = -a2 * hmt * 3;
-						const Real c2 =  c1 - b2 * hmt;
-						const Real d2 =  d1 - a2 * hmt * hmt * hmt;
-						const Real ll = l * l;//compute l^2 once
-						deltaL = a2 * ll * l + b2 * ll + c2 * l + d2;//compute f2(l)
-					}
-				} else {//in f3 or f4, don't bother calculating coefficients for f1 or f2
-					const Real hpt = Real(0.5) + tl;//transition from cubic -> linear in northern cone
-					const Real c4 = (l1 - x * tl) * 2;//compute slope of linear region in northern cone
-					const Real d4 = l1 - c4;//compute intercept of linear region in northern cone
-					if(l >= hpt) {//in second linear region (f4)
-						deltaL = c4 * l + d4;//compute f4(l)
-					} else {//in second cubic region (f3)
-						const Real a3 =  x / (tl * tl);
-						const Real b3 = -a3 * hpt * 3;
-						const Real c3 =  c4 - b3 * hpt;
-						const Real d3 =  d4 - a3 * hpt * hpt * hpt;
-						const Real ll = l * l;//compute l^2 once
-						deltaL = a3 * ll * l + b3 * ll + c3 * l + d3;//compute f3(l)
-					}
-				}
+			if(Smooth) {
+				const size_t c = (sh ? South : North) + (Mirror ? 3 : 0);//coefficients for this cone
+				const Real d = sh ? l - (Real(0.5) - Tl) : l - (Real(0.5) + Tl);//offset from the transition
+				deltaL = lerp(c) * l + lerp(c + 1);//compute f1(l) or f4(l)
+				if(sh ? d > Real(0) : d < Real(0)) deltaL += lerp(c + 2) * d * d * d;//add the cube for f2(l) or f3(l) (multiplied from the left so fixed point products stay small)
 			} else {
-				deltaL = sh ? (l * -2 + 1) * l0 : (l *  2 - 1) * l1;//compute f1(l)
+				deltaL = sh ? (l * -2 + 1) * lerp(DeltaS) : (l *  2 - 1) * lerp(DeltaN);//compute f1(l)
 			}
 
 			//interpolate luminance and compute scaling factor for chromaticity
 			luv[0] += deltaL;
-			Real fc = Real(1) - deltaL / (sh ? l0 : l1);//0->1 bicone scaling
+			Real fc = Real(1) - (std::is_floating_point<Real>::value ? deltaL * lerp(sh ? InvS : InvN) : deltaL / lerp(sh ? DeltaS : DeltaN));//0->1 bicone scaling (Q16.16 reciprocals of the deltas only have ~3 significant digits so Fixed divides instead)
 
 			//adjust chromaticity scaling factor similarly to lightness to make chromaticity C1 continous at equator
-			// f(x) = / f1 =                         x     : 0  < x <= tc (linear from pole to tc)
-			//        \ f2 = a * x^3 + b * x^2 + c * x + d : tc < x <= 1  (cubic from tc to equator)
-			//4 unknowns solved for with C2 continuity between f1/f2 (3 constraints) and f'(1) = 0 (C1 continuity at equator)
+			// f(x) = / f1 = x                  : 0  < x <= tc (linear from pole to tc)
+			//        \ f2 = x + a * (x - tc)^3 : tc < x <= 1  (cubic from tc to equator, C2 continuous with f1 by construction)
+			//a is solved for with f'(1) = 0 (C1 continuity at equator)
 			static const Real tc = Real(0.8);//this parameter is less sensitive than tl since local uniformity is more strongly L* dependant
 			static const Real ac = Real(-1) / ( (tc - 1) * (tc - 1) * 3 );
-			static const Real bc = -tc * 3 * ac;
-			static const Real cc = (tc * 6 - 3) * ac;
-			static const Real dc = -tc * tc * tc * ac;
 			static const Real mc = Real(3) / (tc + 2);
-			if(fc > tc && smooth) {
-				const Real fcfc = fc * fc;//compute fc^2 once
-				fc = ac * fcfc * fc + bc * fcfc + cc * fc + dc;//compute f2(fc)
+			if(Smooth && fc > tc) {
+				const Real dc = fc - tc;//offset from the transition
+				fc += ac * dc * dc * dc;//compute f2(fc)
 			}
 			luv[1] *= fc; luv[2] *= fc;
 		}
@@ -772,6 +2319,118 @@ namespace colormap {
 		}
 	}//namespace detail
 
+	////////////////////////////////////////////////////////////////
+	//                    Runtime Color Maps                      //
+	////////////////////////////////////////////////////////////////
+
+	//@brief: ramp or cyclic color map from a Luv control polygon chosen at run time (same evaluation as the predefined maps)
+	template <typename Real>
+	class DynamicLut : private detail::DynamicSpline<Real, 3, 3> {
+		public:
+			//@brief       : construct a color map directly from cubic spline control points
+			//@param luv   : control points in Luv space (n * 3)
+			//@param n     : number of control points (at least 4)
+			//@param cyclic: true/false if the control points form a closed loop (only used to select wrap around when baking)
+			DynamicLut(Real const * const luv, const size_t n, const bool cyclic = false) : detail::DynamicSpline<Real, 3, 3>(luv, n), cyc(cyclic) {}
+
+			//@brief    : construct a ramp with the same padding as the predefined ramps (f''(t) == 0 at the ends)
+			//@param luv: colors to pass through in Luv space (n * 3), should be uniformly spaced in L*
+			//@param n  : number of colors (at least 2)
+			//@return   : ramp color map
+			static DynamicLut padded(Real const * const luv, const size_t n);
+
+			//@brief    : construct a cycle with the same subdivision as the predefined cyclic maps
+			//@param luv: corners of closed control polygon in Luv space (n * 3)
+			//@param n  : number of corners (at least 2)
+			//@return   : cyclic color map
+			static DynamicLut looped(Real const * const luv, const size_t n);
+
+			//@brief     : get the rgb value corresponding to a fractional position on the map
+			//@param t   : fractional position on map [0,1]
+			//@param rgb : location to write rgb color [0,1]
+			//@param prof: rgb color space to write colors in
+			void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {this->interpolate(t, false, rgb); prof.luv2rgb(rgb, rgb);}
+
+			//@brief      : get 8 bit rgb values for an array of fractional positions on the map
+			//@param t    : fractional positions on map [0,1]
+			//@param rgb  : location to write n interleaved 8 bit colors
+			//@param n    : number of positions
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			//@param prof : rgb color space to write colors in
+			void operator()(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha = false, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {
+				detail::writeRgb8<Real>(n, rgb, alpha, prof, [this, t](const size_t i, const size_t m, Real * const luv){this->interpolate(t + i, m, false, luv, detail::Bound::Throw);});
+			}
+
+			//@brief     : get rgb values for n evenly spaced positions along the map (0 -> 1 inclusive)
+			//@param n   : number of positions
+			//@param rgb : location to write n interleaved colors
+			//@param prof: rgb color space to write colors in
+			void sweep(const size_t n, Real * const rgb, const color::Profile<Real>& prof = color::Profile<Real>::sRGB()) const {detail::DynamicSpline<Real, 3, 3>::sweep(n, false, rgb); prof.luv2rgb(rgb, rgb, n, color::Layout::Interleaved);}
+
+			//@brief  : map a fractional perceptual distance along the map to the spline parameter
+			//@param u: fractional distance along map in Delta E*uv [0, 1]
+			//@return : position t along map such that the arc length in Luv from 0 -> t is u times the total
+			Real uniform(const Real u) const {return detail::arcParameter(arc, [this](const size_t n, Real * const luv){detail::DynamicSpline<Real, 3, 3>::sweep(n, false, luv);}, u);}
+
+			//@brief : check if the map is cyclic
+			//@return: true/false for cyclic/ramp
+			bool cyclic() const {return cyc;}
+
+		private:
+			bool                            cyc;//true/false for cyclic/ramp
+			mutable detail::ArcLength<Real> arc;//lazily built inverse arc length table
+	};
+
+	//@brief    : construct a ramp with the same padding as the predefined ramps (f''(t) == 0 at the ends)
+	//@param luv: colors to pass through in Luv space (n * 3), should be uniformly spaced in L*
+	//@param n  : number of colors (at least 2)
+	//@return   : ramp color map
+	template <typename Real>
+	DynamicLut<Real> DynamicLut<Real>::padded(Real const * const luv, const size_t n) {
+		if(n < 2) throw std::invalid_argument("ramps need at least 2 colors");
+		std::vector<Real> pts((n + 2) * 3);
+		detail::padPoints<Real, 3>(luv, n, pts.data());
+		return DynamicLut(pts.data(), n + 2, false);
+	}
+
+	//@brief    : construct a cycle with the same subdivision as the predefined cyclic maps
+	//@param luv: corners of closed control polygon in Luv space (n * 3)
+	//@param n  : number of corners (at least 2)
+	//@return   : cyclic color map
+	template <typename Real>
+	DynamicLut<Real> DynamicLut<Real>::looped(Real const * const luv, const size_t n) {
+		if(n < 2) throw std::invalid_argument("cycles need at least 2 colors");
+		std::vector<Real> pts((n + 1) * 3 * 3);
+		detail::loopPoints<Real, 3, 3>(luv, n, pts.data());
+		return DynamicLut(pts.data(), (n + 1) * 3, true);
+	}
+
+	//@brief: perceptually uniform bicone with equator colors chosen at run time (same evaluation as the predefined disk, sphere, and ball maps)
+	template <typename Real>
+	class DynamicBicone : public detail::SplineBicone<Real, detail::DynamicSpline<Real, 3, 3> > {
+		public:
+			//@brief        : perceptually uniform HSL like coloring with n colors specified around the equator
+			//@param corners: color for n points around equator in Luv space (n * 3), hue control points for lightness = 0.5
+			//@param n      : number of corners (at least 2)
+			//@param l0     : L* at tip of bottom cone pole (lightness = 0), below the equator lightness at every hue
+			//@param l1     : L* at tip of top    cone pole (lightness = 1), above the equator lightness at every hue
+			//@note         : throws std::invalid_argument for fewer than 2 corners or poles that don't bracket the equator
+			DynamicBicone(Real const * const corners, const size_t n, const Real l0, const Real l1) : 
+				detail::SplineBicone<Real, detail::DynamicSpline<Real, 3, 3> >(equator(corners, n), l0, detail::equatorL(corners, n), l1) {}
+
+		private:
+			//@brief        : build the closed equator spline with the same subdivision as the predefined bicones
+			//@param corners: color for n points around equator in Luv space (n * 3)
+			//@param n      : number of corners
+			//@return       : equator spline
+			static detail::DynamicSpline<Real, 3, 3> equator(Real const * const corners, const size_t n) {
+				if(n < 2) throw std::invalid_argument("bicones need at least 2 corners");
+				std::vector<Real> pts((n + 1) * 3 * 3);
+				detail::loopPoints<Real, 3, 3>(corners, n, pts.data());
+				return detail::DynamicSpline<Real, 3, 3>(pts.data(), (n + 1) * 3);
+			}
+	};
+
 	////////////////////////////////////////////////////////////////
 	//           Predefined Color Maps Implementations            //
 	////////////////////////////////////////////////////////////////
@@ -782,6 +2441,61 @@ namespace colormap {
 		template <typename Real> void ocean(const Real t, Real * const rgb) {detail::Maps<Real>::Ocean (t, rgb);}
 		template <typename Real> void ice  (const Real t, Real * const rgb) {detail::Maps<Real>::Ice   (t, rgb);}
 		template <typename Real> void div  (const Real t, Real * const rgb) {detail::Maps<Real>::Div   (t, rgb);}
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void gray (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::Gray  (t, rgb, prof);}
+		template <typename Real> void fire (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::Fire  (t, rgb, prof);}
+		template <typename Real> void ocean(const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::Ocean (t, rgb, prof);}
+		template <typename Real> void ice  (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::Ice   (t, rgb, prof);}
+		template <typename Real> void div  (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::Div   (t, rgb, prof);}
+
+		//@brief      : same as above but for arrays of positions written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles)
+		template <typename Real> void gray (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::Gray  (t, rgb, n, alpha, prof); else detail::Maps<Real>::Gray  (t, rgb, n, alpha, prof);}
+		template <typename Real> void fire (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::Fire  (t, rgb, n, alpha, prof); else detail::Maps<Real>::Fire  (t, rgb, n, alpha, prof);}
+		template <typename Real> void ocean(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::Ocean (t, rgb, n, alpha, prof); else detail::Maps<Real>::Ocean (t, rgb, n, alpha, prof);}
+		template <typename Real> void ice  (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::Ice   (t, rgb, n, alpha, prof); else detail::Maps<Real>::Ice   (t, rgb, n, alpha, prof);}
+		template <typename Real> void div  (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::Div   (t, rgb, n, alpha, prof); else detail::Maps<Real>::Div   (t, rgb, n, alpha, prof);}
+
+		//@brief     : compute colors for n evenly spaced positions along a ramp (0 -> 1 inclusive)
+		//@param ramp: color map function to use
+		//@param rgb : location to write n interleaved colors
+		//@param n   : number of positions
+		template <typename Real> void sweep(func<Real> ramp, Real * const rgb, const size_t n) {
+			if     (ramp == func<Real>(gray <Real>)) detail::Maps<Real>::Gray .sweep(n, rgb);
+			else if(ramp == func<Real>(fire <Real>)) detail::Maps<Real>::Fire .sweep(n, rgb);
+			else if(ramp == func<Real>(ocean<Real>)) detail::Maps<Real>::Ocean.sweep(n, rgb);
+			else if(ramp == func<Real>(ice  <Real>)) detail::Maps<Real>::Ice  .sweep(n, rgb);
+			else if(ramp == func<Real>(div  <Real>)) detail::Maps<Real>::Div  .sweep(n, rgb);
+			else for(size_t i = 0; i < n; i++) ramp(n > 1 ? Real(i) / (n - 1) : Real(0), rgb + 3 * i);//not a predefined map, sample individually
+		}
+
+		//@brief     : map a fractional perceptual distance along a ramp to the position to evaluate it at (exact Delta E*uv uniformity)
+		//@param ramp: color map function to use
+		//@param u   : fractional distance along ramp in Delta E*uv [0, 1]
+		//@return    : position t along ramp such that the color distance from 0 -> t is u times the total
+		template <typename Real> Real uniform(func<Real> ramp, const Real u) {
+			if     (ramp == func<Real>(gray <Real>)) return detail::Maps<Real>::Gray .uniform(u);
+			else if(ramp == func<Real>(fire <Real>)) return detail::Maps<Real>::Fire .uniform(u);
+			else if(ramp == func<Real>(ocean<Real>)) return detail::Maps<Real>::Ocean.uniform(u);
+			else if(ramp == func<Real>(ice  <Real>)) return detail::Maps<Real>::Ice  .uniform(u);
+			else if(ramp == func<Real>(div  <Real>)) return detail::Maps<Real>::Div  .uniform(u);
+			return detail::arcParameter(detail::arcTable(ramp, false), [ramp](const size_t n, Real * const luv){//not a predefined map, measure its sampled colors
+				std::vector<Real> rgb(3 * n);
+				sweep(ramp, rgb.data(), n);
+				color::rgb2luv(rgb.data(), luv, n, color::Layout::Interleaved);
+			}, u);
+		}
+
+		//@brief: CET perceptually uniform linear maps
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb) {detail::TableMap<false>::rgb(Lut, t, rgb);}
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::TableMap<false>::rgb(Lut, t, rgb, prof);}
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {detail::TableMap<false>::rgb8(Lut, t, rgb, n, alpha, prof, be);}
 	}
 
 	namespace cyclic {
@@ -792,8 +2506,765 @@ namespace colormap {
 		template <typename Real> void four (const Real t, Real * const rgb) {detail::Maps<Real>::FourCy(t, rgb);}
 		template <typename Real> void six  (const Real t, Real * const rgb) {detail::Maps<Real>::SixCy (t, rgb);}
 		template <typename Real> void div  (const Real t, Real * const rgb) {detail::Maps<Real>::DivCy (t, rgb);}
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void gray (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::GrayCy(t, rgb, prof);}
+		template <typename Real> void four (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::FourCy(t, rgb, prof);}
+		template <typename Real> void six  (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::SixCy (t, rgb, prof);}
+		template <typename Real> void div  (const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::Maps<Real>::DivCy (t, rgb, prof);}
+
+		//@brief      : same as above but for arrays of positions written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles)
+		template <typename Real> void gray (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::GrayCy(t, rgb, n, alpha, prof); else detail::Maps<Real>::GrayCy(t, rgb, n, alpha, prof);}
+		template <typename Real> void four (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::FourCy(t, rgb, n, alpha, prof); else detail::Maps<Real>::FourCy(t, rgb, n, alpha, prof);}
+		template <typename Real> void six  (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::SixCy (t, rgb, n, alpha, prof); else detail::Maps<Real>::SixCy (t, rgb, n, alpha, prof);}
+		template <typename Real> void div  (Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Fixed == be) detail::Maps<detail::Fixed>::DivCy (t, rgb, n, alpha, prof); else detail::Maps<Real>::DivCy (t, rgb, n, alpha, prof);}
+
+		//@brief       : compute colors for n evenly spaced positions around a cycle (0 -> 1 inclusive)
+		//@param cyclic: color map function to use
+		//@param rgb   : location to write n interleaved colors
+		//@param n     : number of positions
+		template <typename Real> void sweep(func<Real> cyclic, Real * const rgb, const size_t n) {
+			if     (cyclic == func<Real>(gray<Real>)) detail::Maps<Real>::GrayCy.sweep(n, rgb);
+			else if(cyclic == func<Real>(four<Real>)) detail::Maps<Real>::FourCy.sweep(n, rgb);
+			else if(cyclic == func<Real>(six <Real>)) detail::Maps<Real>::SixCy .sweep(n, rgb);
+			else if(cyclic == func<Real>(div <Real>)) detail::Maps<Real>::DivCy .sweep(n, rgb);
+			else for(size_t i = 0; i < n; i++) cyclic(n > 1 ? Real(i) / (n - 1) : Real(0), rgb + 3 * i);//not a predefined map, sample individually
+		}
+
+		//@brief       : map a fractional perceptual distance around a cycle to the position to evaluate it at (exact Delta E*uv uniformity)
+		//@param cyclic: color map function to use
+		//@param u     : fractional distance around cycle in Delta E*uv [0, 1]
+		//@return      : position t around cycle such that the color distance from 0 -> t is u times the total
+		template <typename Real> Real uniform(func<Real> cyclic, const Real u) {
+			if     (cyclic == func<Real>(gray<Real>)) return detail::Maps<Real>::GrayCy.uniform(u);
+			else if(cyclic == func<Real>(four<Real>)) return detail::Maps<Real>::FourCy.uniform(u);
+			else if(cyclic == func<Real>(six <Real>)) return detail::Maps<Real>::SixCy .uniform(u);
+			else if(cyclic == func<Real>(div <Real>)) return detail::Maps<Real>::DivCy .uniform(u);
+			return detail::arcParameter(detail::arcTable(cyclic, true), [cyclic](const size_t n, Real * const luv){//not a predefined map, measure its sampled colors
+				std::vector<Real> rgb(3 * n);
+				sweep(cyclic, rgb.data(), n);
+				color::rgb2luv(rgb.data(), luv, n, color::Layout::Interleaved);
+			}, u);
+		}
+
+		//@brief: CET perceptually uniform cyclic maps
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb) {detail::TableMap<true>::rgb(Lut, t, rgb);}
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(const Real t, Real * const rgb, const color::Profile<Real>& prof) {detail::TableMap<true>::rgb(Lut, t, rgb, prof);}
+		template <typename Real, const std::array<uint8_t, 768>& Lut> void cet(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha, const color::Profile<Real>& prof, const Backend be) {detail::TableMap<true>::rgb8(Lut, t, rgb, n, alpha, prof, be);}
 	};
 
+	//@brief       : bake an sRGB color map
+	//@param map   : color map function to bake (ramp::func and cyclic::func have the same signature)
+	//@param cyclic: true/false to wrap around / clamp at the ends of the table
+	//@param n     : number of table entries (at least 2)
+	template <typename Real>
+	BakedLut<Real>::BakedLut(ramp::func<Real> map, const bool cyclic, const size_t n) : num(n), cyc(cyclic) {
+		bake([map, cyclic](const size_t m, Real * const rgb){
+			if(cyclic) colormap::cyclic::sweep(map, rgb, m);//qualified since the cyclic() member hides the namespace
+			else       colormap::ramp  ::sweep(map, rgb, m);
+		}, color::Profile<Real>::sRGB());
+	}
+
+	//@brief       : bake a color map in an arbitrary rgb color space
+	//@param map   : color map function to bake (ramp::pfunc and cyclic::pfunc have the same signature)
+	//@param prof  : rgb color space to write colors in
+	//@param cyclic: true/false to wrap around / clamp at the ends of the table
+	//@param n     : number of table entries (at least 2)
+	template <typename Real>
+	BakedLut<Real>::BakedLut(ramp::pfunc<Real> map, const color::Profile<Real>& prof, const bool cyclic, const size_t n) : num(n), cyc(cyclic) {
+		bake([map, &prof](const size_t m, Real * const rgb){
+			for(size_t i = 0; i < m; i++) map(Real(i) / (m - 1), rgb + 3 * i, prof);
+		}, prof);
+	}
+
+	//@brief       : bake a spline color map
+	//@param lut   : spline to bake
+	//@param cyclic: true/false to wrap around / clamp at the ends of the table
+	//@param n     : number of table entries (at least 2)
+	//@param prof  : rgb color space to write colors in
+	template <typename Real>
+	template <size_t N>
+	BakedLut<Real>::BakedLut(const detail::UniformLut<N, Real>& lut, const bool cyclic, const size_t n, const color::Profile<Real>& prof) : num(n), cyc(cyclic) {
+		bake([&lut, &prof](const size_t m, Real * const rgb){lut.sweep(m, rgb, prof);}, prof);
+	}
+
+	//@brief     : bake a runtime spline color map (wraps around if the map is cyclic)
+	//@param lut : spline to bake
+	//@param n   : number of table entries (at least 2)
+	//@param prof: rgb color space to write colors in
+	template <typename Real>
+	BakedLut<Real>::BakedLut(const DynamicLut<Real>& lut, const size_t n, const color::Profile<Real>& prof) : num(n), cyc(lut.cyclic()) {
+		bake([&lut, &prof](const size_t m, Real * const rgb){lut.sweep(m, rgb, prof);}, prof);
+	}
+
+	//@brief       : get a table for a color map, baking it on first use (thread safe)
+	//@param map   : color map function to bake
+	//@param prof  : rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+	//@param cyclic: true/false to wrap around / clamp at the ends of the table
+	//@return      : cached table with DefaultSize entries
+	template <typename Real>
+	const BakedLut<Real>& BakedLut<Real>::cached(ramp::pfunc<Real> map, const color::Profile<Real>& prof, const bool cyclic) {
+		struct Entry {
+			ramp::pfunc<Real>               map ;
+			color::Profile<Real> const *    prof;
+			bool                            cyc ;
+			std::unique_ptr<const BakedLut> lut ;
+		};
+		static std::mutex         mut  ;
+		static std::vector<Entry> cache;//only a handful of map/profile combinations are ever used so a linear search is fine
+		std::lock_guard<std::mutex> lock(mut);
+		for(const Entry& e : cache) if(e.map == map && e.prof == &prof && e.cyc == cyclic) return *e.lut;
+		cache.push_back(Entry{map, &prof, cyclic, std::unique_ptr<const BakedLut>(new BakedLut(map, prof, cyclic))});
+		return *cache.back().lut;
+	}
+
+	//@brief    : get the color at a fractional position
+	//@param t  : fractional position [0,1] (clamped for ramps, wrapped for cycles, nan is treated as 0)
+	//@param rgb: location to write rgb color [0,1]
+	template <typename Real>
+	void BakedLut<Real>::operator()(const Real t, Real * const rgb) const {
+		Real const * p, * q;
+		Real f;
+		locate(t, p, q, f);
+		for(size_t k = 0; k < 3; k++) rgb[k] = p[k] + (q[k] - p[k]) * f;
+	}
+
+	//@brief    : get the 8 bit color at a fractional position
+	//@param t  : fractional position [0,1] (clamped for ramps, wrapped for cycles, nan is treated as 0)
+	//@param rgb: location to write rgb color [0,255]
+	template <typename Real>
+	void BakedLut<Real>::operator()(const Real t, uint8_t * const rgb) const {
+		Real c[3];
+		operator()(t, c);
+		for(size_t k = 0; k < 3; k++) rgb[k] = (uint8_t)(c[k] * 255 + Real(0.5));//entries are already in [0,1]
+	}
+
+	//@brief      : get 8 bit colors for an array of fractional positions
+	//@param t    : fractional positions [0,1]
+	//@param rgb  : location to write n interleaved 8 bit colors
+	//@param n    : number of positions
+	//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+	template <typename Real>
+	void BakedLut<Real>::operator()(Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha) const {
+		const size_t stride = alpha ? 4 : 3;
+		for(size_t i = 0; i < n; i++) {
+			operator()(t[i], rgb + stride * i);
+			if(alpha) rgb[stride * i + 3] = 0xFF;
+		}
+	}
+
+	//@brief       : fill the table from a sampler and measure the interpolation error
+	//@param sample: function to compute colors at m evenly spaced positions (0 -> 1 inclusive), void(const size_t m, Real * const rgb)
+	//@param prof  : rgb color space the colors are in
+	template <typename Real>
+	template <typename Sampler>
+	void BakedLut<Real>::bake(Sampler sample, const color::Profile<Real>& prof) {
+		if(num < 2) throw std::invalid_argument("baked color maps need at least 2 entries");
+
+		//sample the entries and a fine grid between them in a single sweep (cycles have an extra interval from the last entry back to the first)
+		const size_t intervals = cyc ? num : num - 1;
+		std::vector<Real> samples(3 * (ErrorGrid * intervals + 1));
+		sample(ErrorGrid * intervals + 1, samples.data());
+		rgb.resize(3 * num);
+		for(size_t i = 0; i < num; i++) std::copy(samples.begin() + 3 * ErrorGrid * i, samples.begin() + 3 * ErrorGrid * i + 3, rgb.begin() + 3 * i);
+
+		//compare the exact grid to the interpolated grid in each interval
+		//(the worst error is only halfway between entries for smooth maps, a kink e.g. from the linear toe of the sRGB curve can put it anywhere)
+		dE = 0;
+		std::vector<Real> err(ErrorGrid + 1);
+		for(size_t i = 0; i < intervals; i++) {
+			Real const * const p = rgb.data() + 3 * i;
+			Real const * const q = rgb.data() + 3 * (i + 1 == num ? 0 : i + 1);
+			for(size_t x = 0; x <= ErrorGrid; x++) {
+				Real mid[3], luv[3], exact[3];
+				for(size_t k = 0; k < 3; k++) mid[k] = p[k] + (q[k] - p[k]) * x / ErrorGrid;
+				prof.rgb2luv(mid, luv);
+				prof.rgb2luv(samples.data() + 3 * (ErrorGrid * i + x), exact);
+				Real d2 = 0;
+				for(size_t k = 0; k < 3; k++) d2 += (luv[k] - exact[k]) * (luv[k] - exact[k]);
+				err[x] = std::sqrt(d2);
+				dE = std::max(dE, err[x]);
+			}
+
+			//a kink between grid points x and x+1 peaks above both, bound it by extending the slopes on either side across [x, x+1]
+			//(the lower of the two extensions, which overestimates the peak by at most one grid step of slope)
+			for(size_t x = 1; x + 2 <= ErrorGrid; x++) {
+				const Real s0 = err[x] - err[x-1], s1 = err[x+2] - err[x+1];//slopes left and right of [x, x+1]
+				if(s0 > 0 && s1 < 0) dE = std::max(dE, std::min(err[x] + s0, err[x+1] - s1));
+			}
+		}
+	}
+
+	//@brief  : find the entries bracketing a fractional position
+	//@param t: fractional position
+	//@param p: location to write pointer to entry at or before t
+	//@param q: location to write pointer to entry after t (wrapped back to the start of the table for cycles)
+	//@param f: location to write fractional distance from p to q [0,1]
+	template <typename Real>
+	void BakedLut<Real>::locate(const Real t, Real const *& p, Real const *& q, Real& f) const {
+		size_t i;
+		if(cyc) {
+			const Real w = t - std::floor(t);//wrap to [0,1)
+			const Real x = (w >= 0 ? w : 0) * num;//nan fails comparison
+			i = std::min((size_t)x, num - 1);
+			f = x - i;
+			p = rgb.data() + 3 * i;
+			q = i + 1 == num ? rgb.data() : p + 3;
+		} else {
+			const Real x = (t > 0 ? (t < 1 ? t : 1) : 0) * (num - 1);//clamp to [0,1], nan fails comparison
+			i = std::min((size_t)x, num - 2);
+			f = x - i;
+			p = rgb.data() + 3 * i;
+			q = p + 3;
+		}
+	}
+
+	//@brief      : build a table for a range of values
+	//@param color: function to compute the color of a fractional position [0,1], void(const double t, T * const rgb) (e.g. a BakedLut or predefined map)
+	//@param vMin : value mapped to 0
+	//@param vMax : value mapped to 1 (if vMax == vMin everything in range maps to 0)
+	//@param alpha: true/false to write rgba (with alpha = 1 or 255) / rgb
+	//@param fill : value for all channels of values outside of [vMin, vMax]
+	template <typename Int, typename T>
+	template <typename Func>
+	IndexedLut<Int, T>::IndexedLut(const Func& color, const double vMin, const double vMax, const bool alpha, const T fill) : stride(alpha ? 4 : 3) {
+		//find the representable values inside the range
+		tbl.assign(Size * stride, fill);
+		const double first = std::max(std::ceil (vMin), 0.0             );
+		const double last  = std::min(std::floor(vMax), double(Size - 1));
+		if(!(first <= last)) {//empty range (or nan bounds), fill everything
+			lo = Size;
+			hi = 0;
+			return;
+		}
+		lo = (size_t)first;
+		hi = (size_t)last ;
+
+		//color the values inside the range
+		const double scale = vMax > vMin ? 1.0 / (vMax - vMin) : 1.0;
+		const T one = std::is_floating_point<T>::value ? T(1) : std::numeric_limits<T>::max();
+		for(size_t v = lo; v <= hi; v++) {
+			T * const c = tbl.data() + stride * v;
+			color(std::min((v - vMin) * scale, 1.0), c);
+			if(alpha) c[3] = one;
+		}
+	}
+
+	//@brief    : color an array of values
+	//@param v  : values to color
+	//@param rgb: location to write n interleaved colors
+	//@param n  : number of values
+	//@return   : true/false if any value fell outside/inside of [vMin, vMax] (and was filled)
+	template <typename Int, typename T>
+	bool IndexedLut<Int, T>::operator()(Int const * const v, T * const rgb, const size_t n) const {
+		bool filled = false;
+		for(size_t i = 0; i < n; i++) {
+			const size_t j = v[i];
+			filled |= j < lo || j > hi;
+			std::copy(tbl.data() + stride * j, tbl.data() + stride * (j + 1), rgb + stride * i);
+		}
+		return filled;
+	}
+
+	//@brief     : bake a disk color map
+	//@param map : color map function to bake
+	//@param w0  : true/false for white/black @ r == 0
+	//@param sym : type of inversion symmetry
+	//@param prof: rgb color space to write colors in
+	//@param nr  : number of radii (at least 2)
+	//@param nt  : number of angles (at least 2)
+	template <typename Real>
+	DiskLut<Real>::DiskLut(disk::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof, const size_t nr, const size_t nt) : nRad(nr), nAng(nt) {
+		if(nr < 2 || nt < 2) throw std::invalid_argument("disk tables need at least 2 radii and 2 angles");
+
+		//sample the entries
+		tbl.resize(3 * nRad * nAng);
+		for(size_t j = 0; j < nRad; j++) {
+			const Real r = Real(j) / (nRad - 1);
+			for(size_t i = 0; i < nAng; i++) map(r, Real(i) / nAng, tbl.data() + 3 * (j * nAng + i), w0, sym, prof);
+		}
+
+		//measure the interpolation error at cell centers and edge midpoints, then refine the worst cells on a finer grid
+		//(the worst error is along creases of the map, e.g. the equator of the bicone, which can cross a cell anywhere)
+		auto error = [&](const Real r, const Real t) {
+			Real mid[3], luv[3], exact[3];
+			operator()(r, t, mid);
+			map(r, t, exact, w0, sym, prof);
+			prof.rgb2luv(mid, luv);
+			prof.rgb2luv(exact, exact);
+			Real d2 = 0;
+			for(size_t k = 0; k < 3; k++) d2 += (luv[k] - exact[k]) * (luv[k] - exact[k]);
+			return std::sqrt(d2);
+		};
+		const Real hr = Real(1) / (nRad - 1), ht = Real(1) / nAng;//cell size
+		std::vector<Real> coarse((nRad - 1) * nAng);
+		dE = 0;
+		for(size_t j = 0; j + 1 < nRad; j++) {
+			for(size_t i = 0; i < nAng; i++) {
+				const Real r = hr * j, t = ht * i;
+				Real& e = coarse[j * nAng + i];
+				e = std::max(error(r + hr / 2, t + ht / 2), std::max(error(r + hr / 2, t), error(r, t + ht / 2)));
+				dE = std::max(dE, e);
+			}
+		}
+		const Real thr = dE / 2;//coarse errors are within a factor of 2 of the cell's worst
+		for(size_t j = 0; j + 1 < nRad; j++) {
+			for(size_t i = 0; i < nAng; i++) {
+				if(coarse[j * nAng + i] < thr) continue;
+				for(size_t y = 0; y < ErrorGrid; y++)
+					for(size_t x = 0; x < ErrorGrid; x++) dE = std::max(dE, error(hr * (j + Real(y) / ErrorGrid), ht * (i + Real(x) / ErrorGrid)));
+			}
+		}
+	}
+
+	//@brief     : get a table for a disk color map, baking it on first use (thread safe)
+	//@param map : color map function to bake
+	//@param w0  : true/false for white/black @ r == 0
+	//@param sym : type of inversion symmetry
+	//@param prof: rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+	//@return    : cached table with the default size
+	template <typename Real>
+	const DiskLut<Real>& DiskLut<Real>::cached(disk::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof) {
+		struct Entry {
+			disk::pfunc<Real>              map ;
+			bool                           w0  ;
+			Sym                            sym ;
+			color::Profile<Real> const *   prof;
+			std::unique_ptr<const DiskLut> lut ;
+		};
+		static std::mutex         mut  ;
+		static std::vector<Entry> cache;//at most a few dozen map/center/symmetry/profile combinations so a linear search is fine
+		std::lock_guard<std::mutex> lock(mut);
+		for(const Entry& e : cache) if(e.map == map && e.w0 == w0 && e.sym == sym && e.prof == &prof) return *e.lut;
+		cache.push_back(Entry{map, w0, sym, &prof, std::unique_ptr<const DiskLut>(new DiskLut(map, w0, sym, prof))});
+		return *cache.back().lut;
+	}
+
+	//@brief    : get the color at a polar coordinate
+	//@param r  : radius [0,1] (clamped, nan is treated as 0)
+	//@param t  : theta [0,1] (wrapped, nan is treated as 0)
+	//@param rgb: location to write rgb color [0,1]
+	template <typename Real>
+	void DiskLut<Real>::operator()(const Real r, const Real t, Real * const rgb) const {
+		//find the bracketing radii
+		const Real y = (r > 0 ? (r < 1 ? r : 1) : 0) * (nRad - 1);//clamp to [0,1], nan fails comparison
+		const size_t j = std::min((size_t)y, nRad - 2);
+		const Real fr = y - j;
+
+		//find the bracketing angles (wrapping from the last angle back to the first)
+		const Real w = t - std::floor(t);//wrap to [0,1)
+		const Real x = (w >= 0 ? w : 0) * nAng;//nan fails comparison
+		const size_t i0 = std::min((size_t)x, nAng - 1);
+		const size_t i1 = i0 + 1 == nAng ? 0 : i0 + 1;
+		const Real ft = x - i0;
+
+		//interpolate in theta along both radii then in r
+		Real const * const p00 = tbl.data() + 3 * ( j      * nAng + i0);
+		Real const * const p01 = tbl.data() + 3 * ( j      * nAng + i1);
+		Real const * const p10 = tbl.data() + 3 * ((j + 1) * nAng + i0);
+		Real const * const p11 = tbl.data() + 3 * ((j + 1) * nAng + i1);
+		for(size_t k = 0; k < 3; k++) {
+			const Real c0 = p00[k] + (p01[k] - p00[k]) * ft;
+			const Real c1 = p10[k] + (p11[k] - p10[k]) * ft;
+			rgb[k] = c0 + (c1 - c0) * fr;
+		}
+	}
+
+	//@brief    : get the 8 bit color at a polar coordinate
+	//@param r  : radius [0,1] (clamped, nan is treated as 0)
+	//@param t  : theta [0,1] (wrapped, nan is treated as 0)
+	//@param rgb: location to write rgb color [0,255]
+	template <typename Real>
+	void DiskLut<Real>::operator()(const Real r, const Real t, uint8_t * const rgb) const {
+		Real c[3];
+		operator()(r, t, c);
+		for(size_t k = 0; k < 3; k++) rgb[k] = (uint8_t)(c[k] * 255 + Real(0.5));//entries are already in [0,1]
+	}
+
+	//@brief      : get 8 bit colors for arrays of polar coordinates
+	//@param r    : radii [0,1]
+	//@param t    : thetas [0,1]
+	//@param rgb  : location to write n interleaved 8 bit colors
+	//@param n    : number of coordinates
+	//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+	template <typename Real>
+	void DiskLut<Real>::operator()(Real const * const r, Real const * const t, uint8_t * const rgb, const size_t n, const bool alpha) const {
+		const size_t stride = alpha ? 4 : 3;
+		for(size_t i = 0; i < n; i++) {
+			operator()(r[i], t[i], rgb + stride * i);
+			if(alpha) rgb[stride * i + 3] = 0xFF;
+		}
+	}
+
+	//@brief     : bake a sphere color map
+	//@param map : color map function to bake
+	//@param w0  : true/false for white/black @ north pole
+	//@param sym : type of inversion symmetry
+	//@param prof: rgb color space to write colors in
+	//@param n   : number of texels along each face edge (at least 2)
+	template <typename Real>
+	SphereLut<Real>::SphereLut(sphere::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof, const size_t n) : num(n), nFace(Sym::None == sym ? 6 : 3) {
+		if(n < 2) throw std::invalid_argument("sphere tables need at least 2 texels per face edge");
+
+		//sample the texels, symmetric maps only store the positive faces (0, 2, 4)
+		const size_t step = 6 / nFace;
+		tbl.resize(3 * nFace * num * num);
+		for(size_t k = 0; k < nFace; k++) {
+			for(size_t j = 0; j < num; j++) {
+				const Real w = Real(j) / (num - 1) * 2 - 1;
+				for(size_t i = 0; i < num; i++) {
+					Real p, a;
+					unproject(k * step, Real(i) / (num - 1) * 2 - 1, w, p, a);
+					map(p, a, tbl.data() + 3 * ((k * num + j) * num + i), w0, sym, prof);
+				}
+			}
+		}
+
+		//measure the interpolation error at texel centers and edge midpoints, then refine the worst texels on a finer grid
+		//(the worst error is along creases of the map, e.g. the edges of a bicone, which can cross a texel anywhere)
+		auto error = [&](const size_t k, const Real u, const Real w) {
+			Real p, a, mid[3], luv[3], exact[3];
+			sample(k, u, w, mid);
+			unproject(k * step, u, w, p, a);
+			map(p, a, exact, w0, sym, prof);
+			prof.rgb2luv(mid, luv);
+			prof.rgb2luv(exact, exact);
+			Real d2 = 0;
+			for(size_t c = 0; c < 3; c++) d2 += (luv[c] - exact[c]) * (luv[c] - exact[c]);
+			return std::sqrt(d2);
+		};
+		const Real h = Real(2) / (num - 1);//texel spacing in face coordinates
+		std::vector<Real> coarse(nFace * (num - 1) * (num - 1));
+		dE = 0;
+		for(size_t k = 0; k < nFace; k++) {
+			for(size_t j = 0; j + 1 < num; j++) {
+				for(size_t i = 0; i + 1 < num; i++) {
+					const Real u = h * i - 1, w = h * j - 1;
+					Real& e = coarse[(k * (num - 1) + j) * (num - 1) + i];
+					e = std::max(error(k, u + h / 2, w + h / 2), std::max(error(k, u + h / 2, w), error(k, u, w + h / 2)));
+					dE = std::max(dE, e);
+				}
+			}
+		}
+		const Real thr = dE / 2;//coarse errors are within a factor of 2 of the texel's worst
+		const size_t g = ErrorGrid + 1;//fine grid points along each texel edge (both edges included)
+		std::vector<Real> err(g * g);
+		for(size_t k = 0; k < nFace; k++) {
+			for(size_t j = 0; j + 1 < num; j++) {
+				for(size_t i = 0; i + 1 < num; i++) {
+					if(coarse[(k * (num - 1) + j) * (num - 1) + i] < thr) continue;
+					for(size_t y = 0; y < g; y++) {
+						for(size_t x = 0; x < g; x++) {
+							err[y * g + x] = error(k, h * (i + Real(x) / ErrorGrid) - 1, h * (j + Real(y) / ErrorGrid) - 1);
+							dE = std::max(dE, err[y * g + x]);
+						}
+					}
+
+					//a crease between grid points peaks above them, bound it by extending the slopes on either side along rows and columns (as for BakedLut)
+					for(size_t l = 0; l < g; l++) {
+						for(size_t x = 1; x + 2 < g; x++) {
+							for(const size_t d : {size_t(1), g}) {//along a row / column
+								Real const * const e = err.data() + (1 == d ? l * g : l) + x * d;
+								const Real s0 = e[0] - e[-(std::ptrdiff_t)d], s1 = e[2 * d] - e[d];//slopes before and after [x, x+1]
+								if(s0 > 0 && s1 < 0) dE = std::max(dE, std::min(e[0] + s0, e[d] - s1));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	//@brief     : get a table for a sphere color map, baking it on first use (thread safe)
+	//@param map : color map function to bake
+	//@param w0  : true/false for white/black @ north pole
+	//@param sym : type of inversion symmetry
+	//@param prof: rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+	//@return    : cached table with the default size
+	template <typename Real>
+	const SphereLut<Real>& SphereLut<Real>::cached(sphere::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof) {
+		struct Entry {
+			sphere::pfunc<Real>              map ;
+			bool                             w0  ;
+			Sym                              sym ;
+			color::Profile<Real> const *     prof;
+			std::unique_ptr<const SphereLut> lut ;
+		};
+		static std::mutex         mut  ;
+		static std::vector<Entry> cache;//at most a few dozen map/center/symmetry/profile combinations so a linear search is fine
+		std::lock_guard<std::mutex> lock(mut);
+		for(const Entry& e : cache) if(e.map == map && e.w0 == w0 && e.sym == sym && e.prof == &prof) return *e.lut;
+		cache.push_back(Entry{map, w0, sym, &prof, std::unique_ptr<const SphereLut>(new SphereLut(map, w0, sym, prof))});
+		return *cache.back().lut;
+	}
+
+	//@brief    : get the color of a direction
+	//@param v  : direction (x, y, z), doesn't need to be normalized (nan and 0 are treated as a direction on a face edge)
+	//@param rgb: location to write rgb color [0,1]
+	template <typename Real>
+	void SphereLut<Real>::operator()(Real const * const v, Real * const rgb) const {
+		size_t f;
+		Real u, w;
+		project(v, f, u, w);
+		sample(6 == nFace ? f : f / 2, u, w, rgb);//symmetric directions were already folded onto the positive faces
+	}
+
+	//@brief    : get the color at a fractional spherical coordinate
+	//@param p  : phi [0, 1] (polar angle 0->north pole, 0.5->equator, 1-> south pole)
+	//@param a  : theta [0, 1] (azimuthal angle)
+	//@param rgb: location to write rgb color [0,1]
+	template <typename Real>
+	void SphereLut<Real>::operator()(const Real p, const Real a, Real * const rgb) const {
+		const Real theta = Real(M_PI * 2) * a;
+		const Real phi   = Real(M_PI    ) * p;
+		const Real s = std::sin(phi);
+		const Real v[3] = {s * std::cos(theta), s * std::sin(theta), std::cos(phi)};
+		operator()(v, rgb);
+	}
+
+	//@brief      : get 8 bit colors for an array of directions
+	//@param v    : directions (n * 3 interleaved)
+	//@param rgb  : location to write n interleaved 8 bit colors
+	//@param n    : number of directions
+	//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+	template <typename Real>
+	void SphereLut<Real>::operator()(Real const * const v, uint8_t * const rgb, const size_t n, const bool alpha) const {
+		const size_t stride = alpha ? 4 : 3;
+		for(size_t i = 0; i < n; i++) {
+			Real c[3];
+			operator()(v + 3 * i, c);
+			for(size_t k = 0; k < 3; k++) rgb[stride * i + k] = (uint8_t)(c[k] * 255 + Real(0.5));//entries are already in [0,1]
+			if(alpha) rgb[stride * i + 3] = 0xFF;
+		}
+	}
+
+	//@brief      : get 8 bit colors for arrays of fractional spherical coordinates
+	//@param p    : phis [0,1]
+	//@param a    : thetas [0,1]
+	//@param rgb  : location to write n interleaved 8 bit colors
+	//@param n    : number of coordinates
+	//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+	template <typename Real>
+	void SphereLut<Real>::operator()(Real const * const p, Real const * const a, uint8_t * const rgb, const size_t n, const bool alpha) const {
+		const size_t stride = alpha ? 4 : 3;
+		for(size_t i = 0; i < n; i++) {
+			Real c[3];
+			operator()(p[i], a[i], c);
+			for(size_t k = 0; k < 3; k++) rgb[stride * i + k] = (uint8_t)(c[k] * 255 + Real(0.5));//entries are already in [0,1]
+			if(alpha) rgb[stride * i + 3] = 0xFF;
+		}
+	}
+
+	//@brief    : find the face and face coordinates of a direction
+	//@param v  : direction
+	//@param f  : location to write face index (2 * axis + 1 for negative faces)
+	//@param u  : location to write first  face coordinate [-1,1]
+	//@param w  : location to write second face coordinate [-1,1]
+	template <typename Real>
+	void SphereLut<Real>::project(Real const * const v, size_t& f, Real& u, Real& w) const {
+		//the largest component selects the face
+		const Real ax = std::fabs(v[0]), ay = std::fabs(v[1]), az = std::fabs(v[2]);
+		const size_t axis = ax >= ay ? (ax >= az ? 0 : 2) : (ay >= az ? 1 : 2);
+		const bool neg = std::signbit(v[axis]);
+
+		//project onto the face, inversion symmetric maps fold -v onto +v
+		const Real s = (neg && 6 != nFace ? Real(-1) : Real(1)) / std::fabs(v[axis]);
+		f = 2 * axis + (neg && 6 == nFace ? 1 : 0);
+		u = v[(axis + 1) % 3] * s;
+		w = v[(axis + 2) % 3] * s;
+	}
+
+	//@brief    : convert face coordinates back to fractional spherical coordinates
+	//@param f  : face index
+	//@param u  : first  face coordinate
+	//@param w  : second face coordinate
+	//@param p  : location to write phi [0,1]
+	//@param a  : location to write theta [0,1]
+	template <typename Real>
+	void SphereLut<Real>::unproject(const size_t f, const Real u, const Real w, Real& p, Real& a) {
+		const size_t axis = f / 2;
+		Real v[3];
+		v[axis] = f % 2 ? Real(-1) : Real(1);
+		v[(axis + 1) % 3] = u;
+		v[(axis + 2) % 3] = w;
+		const Real r = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+		p = std::acos(std::max(Real(-1), std::min(Real(1), v[2] / r))) / Real(M_PI);
+		a = std::atan2(v[1], v[0]) / Real(M_PI * 2);//[-0.5,0.5]
+		if(std::signbit(a)) a += Real(1);//[0,1]
+	}
+
+	//@brief    : interpolate a color from a face
+	//@param f  : face index (of a stored face)
+	//@param u  : first  face coordinate [-1,1]
+	//@param w  : second face coordinate [-1,1]
+	//@param rgb: location to write rgb color
+	template <typename Real>
+	void SphereLut<Real>::sample(const size_t f, const Real u, const Real w, Real * const rgb) const {
+		//find the bracketing texels
+		const Real x = (u > -1 ? (u < 1 ? u + 1 : 2) : 0) * (num - 1) / 2;//clamp to [-1,1], nan fails comparison
+		const Real y = (w > -1 ? (w < 1 ? w + 1 : 2) : 0) * (num - 1) / 2;
+		const size_t i = std::min((size_t)x, num - 2);
+		const size_t j = std::min((size_t)y, num - 2);
+		const Real fu = x - i;
+		const Real fw = y - j;
+
+		//interpolate along u on both rows then along w
+		Real const * const p00 = tbl.data() + 3 * ((f * num + j) * num + i);
+		Real const * const p01 = p00 + 3;
+		Real const * const p10 = p00 + 3 * num;
+		Real const * const p11 = p10 + 3;
+		for(size_t k = 0; k < 3; k++) {
+			const Real c0 = p00[k] + (p01[k] - p00[k]) * fu;
+			const Real c1 = p10[k] + (p11[k] - p10[k]) * fu;
+			rgb[k] = c0 + (c1 - c0) * fw;
+		}
+	}
+
+	//@brief     : bake a ball color map
+	//@param map : color map function to bake
+	//@param w0  : true/false for white/black @ north pole
+	//@param sym : type of inversion symmetry
+	//@param prof: rgb color space to write colors in
+	//@param nr  : number of radii (at least 2)
+	//@param na  : number of azimuthal angles (at least 2)
+	//@param np  : number of polar angles (at least 2)
+	template <typename Real>
+	BallLut<Real>::BallLut(ball::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof, const size_t nr, const size_t na, const size_t np) : nRad(nr), nAzi(na), nPol(np) {
+		if(nr < 2 || na < 2 || np < 2) throw std::invalid_argument("ball tables need at least 2 radii, azimuths, and polars");
+
+		//sample the entries
+		tbl.resize(3 * nRad * nPol * nAzi);
+		for(size_t k = 0; k < nRad; k++) {
+			const Real r = Real(k) / (nRad - 1);
+			for(size_t j = 0; j < nPol; j++) {
+				const Real p = Real(j) / (nPol - 1);
+				for(size_t i = 0; i < nAzi; i++) map(r, Real(i) / nAzi, p, tbl.data() + 3 * ((k * nPol + j) * nAzi + i), w0, sym, prof);
+			}
+		}
+
+		//measure the interpolation error at voxel centers then refine the worst voxels on a finer grid
+		//(as for SphereLut the worst error is along creases of the map which can cross a voxel anywhere)
+		auto error = [&](const Real r, const Real a, const Real p) {
+			Real mid[3], luv[3], exact[3];
+			operator()(r, a, p, mid);
+			map(r, a, p, exact, w0, sym, prof);
+			prof.rgb2luv(mid, luv);
+			prof.rgb2luv(exact, exact);
+			Real d2 = 0;
+			for(size_t c = 0; c < 3; c++) d2 += (luv[c] - exact[c]) * (luv[c] - exact[c]);
+			return std::sqrt(d2);
+		};
+		const Real hr = Real(1) / (nRad - 1), ha = Real(1) / nAzi, hp = Real(1) / (nPol - 1);//voxel size
+		std::vector<Real> coarse((nRad - 1) * (nPol - 1) * nAzi);
+		dE = 0;
+		for(size_t k = 0; k + 1 < nRad; k++) {
+			for(size_t j = 0; j + 1 < nPol; j++) {
+				for(size_t i = 0; i < nAzi; i++) {
+					const Real r = hr * k, a = ha * i, p = hp * j;
+					const Real e = error(r + hr / 2, a + ha / 2, p + hp / 2);
+					coarse[(k * (nPol - 1) + j) * nAzi + i] = e;
+					dE = std::max(dE, e);
+				}
+			}
+		}
+		const Real thr = dE / 2;//center errors are within a factor of 2 of the voxel's worst
+		for(size_t k = 0; k + 1 < nRad; k++) {
+			for(size_t j = 0; j + 1 < nPol; j++) {
+				for(size_t i = 0; i < nAzi; i++) {
+					if(coarse[(k * (nPol - 1) + j) * nAzi + i] < thr) continue;
+					for(size_t z = 0; z < ErrorGrid; z++)
+						for(size_t y = 0; y < ErrorGrid; y++)
+							for(size_t x = 0; x < ErrorGrid; x++) dE = std::max(dE, error(hr * (k + Real(z) / ErrorGrid), ha * (i + Real(x) / ErrorGrid), hp * (j + Real(y) / ErrorGrid)));
+				}
+			}
+		}
+	}
+
+	//@brief     : get a table for a ball color map, baking it on first use (thread safe)
+	//@param map : color map function to bake
+	//@param w0  : true/false for white/black @ north pole
+	//@param sym : type of inversion symmetry
+	//@param prof: rgb color space to write colors in (must outlive the cache, e.g. one of the predefined profiles)
+	//@return    : cached table with the default size
+	template <typename Real>
+	const BallLut<Real>& BallLut<Real>::cached(ball::pfunc<Real> map, const bool w0, const Sym sym, const color::Profile<Real>& prof) {
+		struct Entry {
+			ball::pfunc<Real>              map ;
+			bool                           w0  ;
+			Sym                            sym ;
+			color::Profile<Real> const *   prof;
+			std::unique_ptr<const BallLut> lut ;
+		};
+		static std::mutex         mut  ;
+		static std::vector<Entry> cache;//at most a few dozen map/center/symmetry/profile combinations so a linear search is fine
+		std::lock_guard<std::mutex> lock(mut);
+		for(const Entry& e : cache) if(e.map == map && e.w0 == w0 && e.sym == sym && e.prof == &prof) return *e.lut;
+		cache.push_back(Entry{map, w0, sym, &prof, std::unique_ptr<const BallLut>(new BallLut(map, w0, sym, prof))});
+		return *cache.back().lut;
+	}
+
+	//@brief    : get the color at a fractional spherical coordinate
+	//@param r  : radius [0,1] (clamped, nan is treated as 0)
+	//@param a  : theta [0,1] (wrapped, nan is treated as 0)
+	//@param p  : phi [0,1] (clamped, nan is treated as 0)
+	//@param rgb: location to write rgb color [0,1]
+	template <typename Real>
+	void BallLut<Real>::operator()(const Real r, const Real a, const Real p, Real * const rgb) const {
+		//find the bracketing radii and polar angles
+		const Real z = (r > 0 ? (r < 1 ? r : 1) : 0) * (nRad - 1);//clamp to [0,1], nan fails comparison
+		const Real y = (p > 0 ? (p < 1 ? p : 1) : 0) * (nPol - 1);
+		const size_t k = std::min((size_t)z, nRad - 2);
+		const size_t j = std::min((size_t)y, nPol - 2);
+		const Real fr = z - k;
+		const Real fp = y - j;
+
+		//find the bracketing azimuthal angles (wrapping from the last angle back to the first)
+		const Real w = a - std::floor(a);//wrap to [0,1)
+		const Real x = (w >= 0 ? w : 0) * nAzi;//nan fails comparison
+		const size_t i0 = std::min((size_t)x, nAzi - 1);
+		const size_t i1 = i0 + 1 == nAzi ? 0 : i0 + 1;
+		const Real fa = x - i0;
+
+		//interpolate in theta along the 4 surrounding (r, phi) edges, then in phi, then in r
+		Real const * const p00 = tbl.data() + 3 * ((k * nPol + j) * nAzi);//r = k    , phi = j
+		Real const * const p01 = p00 + 3 * nAzi;                          //r = k    , phi = j + 1
+		Real const * const p10 = p00 + 3 * nAzi * nPol;                   //r = k + 1, phi = j
+		Real const * const p11 = p10 + 3 * nAzi;                          //r = k + 1, phi = j + 1
+		for(size_t c = 0; c < 3; c++) {
+			const Real c00 = p00[3 * i0 + c] + (p00[3 * i1 + c] - p00[3 * i0 + c]) * fa;
+			const Real c01 = p01[3 * i0 + c] + (p01[3 * i1 + c] - p01[3 * i0 + c]) * fa;
+			const Real c10 = p10[3 * i0 + c] + (p10[3 * i1 + c] - p10[3 * i0 + c]) * fa;
+			const Real c11 = p11[3 * i0 + c] + (p11[3 * i1 + c] - p11[3 * i0 + c]) * fa;
+			const Real c0 = c00 + (c01 - c00) * fp;
+			const Real c1 = c10 + (c11 - c10) * fp;
+			rgb[c] = c0 + (c1 - c0) * fr;
+		}
+	}
+
+	//@brief      : get 8 bit colors for arrays of fractional spherical coordinates
+	//@param r    : radii [0,1]
+	//@param a    : thetas [0,1]
+	//@param p    : phis [0,1]
+	//@param rgb  : location to write n interleaved 8 bit colors
+	//@param n    : number of coordinates
+	//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+	template <typename Real>
+	void BallLut<Real>::operator()(Real const * const r, Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool alpha) const {
+		const size_t stride = alpha ? 4 : 3;
+		for(size_t i = 0; i < n; i++) {
+			Real c[3];
+			operator()(r[i], a[i], p[i], c);
+			for(size_t k = 0; k < 3; k++) rgb[stride * i + k] = (uint8_t)(c[k] * 255 + Real(0.5));//entries are already in [0,1]
+			if(alpha) rgb[stride * i + 3] = 0xFF;
+		}
+	}
+
 	namespace disk {
 		//@brief    : predefined perceptually uniform color maps for the unit disk
 		//@param r  : radius [0, 1]
@@ -803,6 +3274,20 @@ namespace colormap {
 		//@param sym: type of inversion symmetry
 		template <typename Real> void four (const Real r, const Real t, Real * const rgb, const bool w0, const Sym sym) {detail::Maps<Real>::FourBi.disk(r, t, rgb, w0, sym);}
 		template <typename Real> void six  (const Real r, const Real t, Real * const rgb, const bool w0, const Sym sym) {detail::Maps<Real>::SixBi .disk(r, t, rgb, w0, sym);}
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void four (const Real r, const Real t, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) {detail::Maps<Real>::FourBi.disk(r, t, rgb, w0, sym, prof);}
+		template <typename Real> void six  (const Real r, const Real t, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) {detail::Maps<Real>::SixBi .disk(r, t, rgb, w0, sym, prof);}
+
+		//@brief      : same as above but for arrays of coordinates written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles, the table backend interpolates DiskLut::cached)
+		template <typename Real> void four (Real const * const r, Real const * const t, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Table == be) DiskLut<Real>::cached(four<Real>, w0, sym, prof)(r, t, rgb, n, alpha); else if(Backend::Fixed == be) detail::Maps<detail::Fixed>::FourBi.disk(r, t, rgb, n, w0, sym, alpha, prof); else detail::Maps<Real>::FourBi.disk(r, t, rgb, n, w0, sym, alpha, prof);}
+		template <typename Real> void six  (Real const * const r, Real const * const t, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Table == be) DiskLut<Real>::cached(six<Real>, w0, sym, prof)(r, t, rgb, n, alpha); else if(Backend::Fixed == be) detail::Maps<detail::Fixed>::SixBi .disk(r, t, rgb, n, w0, sym, alpha, prof); else detail::Maps<Real>::SixBi .disk(r, t, rgb, n, w0, sym, alpha, prof);}
 	}
 
 	namespace sphere {
@@ -814,6 +3299,20 @@ namespace colormap {
 		//@param sym: type of inversion symmetry
 		template <typename Real> void four (const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) {detail::Maps<Real>::FourBi.sphere(p, a, rgb, w0, sym);}
 		template <typename Real> void six  (const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) {detail::Maps<Real>::SixBi .sphere(p, a, rgb, w0, sym);}
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void four (const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) {detail::Maps<Real>::FourBi.sphere(p, a, rgb, w0, sym, prof);}
+		template <typename Real> void six  (const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) {detail::Maps<Real>::SixBi .sphere(p, a, rgb, w0, sym, prof);}
+
+		//@brief      : same as above but for arrays of coordinates written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles, the table backend interpolates SphereLut::cached)
+		template <typename Real> void four (Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Table == be) SphereLut<Real>::cached(four<Real>, w0, sym, prof)(a, p, rgb, n, alpha); else if(Backend::Fixed == be) detail::Maps<detail::Fixed>::FourBi.sphere(p, a, rgb, n, w0, sym, alpha, prof); else detail::Maps<Real>::FourBi.sphere(p, a, rgb, n, w0, sym, alpha, prof);}
+		template <typename Real> void six  (Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Table == be) SphereLut<Real>::cached(six<Real>, w0, sym, prof)(a, p, rgb, n, alpha); else if(Backend::Fixed == be) detail::Maps<detail::Fixed>::SixBi .sphere(p, a, rgb, n, w0, sym, alpha, prof); else detail::Maps<Real>::SixBi .sphere(p, a, rgb, n, w0, sym, alpha, prof);}
 	}
 
 	namespace ball {
@@ -826,8 +3325,433 @@ namespace colormap {
 		//@param sym: type of inversion symmetry
 		template <typename Real> void four (const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) {detail::Maps<Real>::FourBi.ball(r, a, p, rgb, w0, sym);}
 		template <typename Real> void six  (const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym) {detail::Maps<Real>::SixBi .ball(r, a, p, rgb, w0, sym);}
+
+		//@brief     : same as above but writing colors in an arbitrary rgb color space
+		//@param prof: rgb color space to write colors in
+		template <typename Real> void four (const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) {detail::Maps<Real>::FourBi.ball(r, a, p, rgb, w0, sym, prof);}
+		template <typename Real> void six  (const Real r, const Real a, const Real p, Real * const rgb, const bool w0, const Sym sym, const color::Profile<Real>& prof) {detail::Maps<Real>::SixBi .ball(r, a, p, rgb, w0, sym, prof);}
+
+		//@brief      : same as above but for arrays of coordinates written directly to 8 bit rgb (no intermediate floating point colors)
+		//@param rgb  : location to write n interleaved 8 bit colors
+		//@param n    : number of colors to compute
+		//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+		//@param prof : rgb color space to write colors in
+		//@param be   : arithmetic backend (the fixed point backend matches the floating point backend to within 1 for the predefined profiles, the table backend interpolates BallLut::cached)
+		template <typename Real> void four (Real const * const r, Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Table == be) BallLut<Real>::cached(four<Real>, w0, sym, prof)(r, a, p, rgb, n, alpha); else if(Backend::Fixed == be) detail::Maps<detail::Fixed>::FourBi.ball(r, a, p, rgb, n, w0, sym, alpha, prof); else detail::Maps<Real>::FourBi.ball(r, a, p, rgb, n, w0, sym, alpha, prof);}
+		template <typename Real> void six  (Real const * const r, Real const * const a, Real const * const p, uint8_t * const rgb, const size_t n, const bool w0, const Sym sym, const bool alpha, const color::Profile<Real>& prof, const Backend be) {if(Backend::Table == be) BallLut<Real>::cached(six<Real>, w0, sym, prof)(r, a, p, rgb, n, alpha); else if(Backend::Fixed == be) detail::Maps<detail::Fixed>::SixBi .ball(r, a, p, rgb, n, w0, sym, alpha, prof); else detail::Maps<Real>::SixBi .ball(r, a, p, rgb, n, w0, sym, alpha, prof);}
 	}
 	
+	////////////////////////////////////////////////////////////////
+	//         Statically Dispatched Batch Implementations        //
+	////////////////////////////////////////////////////////////////
+
+	//functors take the symmetry and center color as template arguments so each colorize instantiation calls the matching compile time bicone overload directly
+	namespace ramp {
+		template <typename Real> struct Gray  {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::Gray  (t, rgb, prof);}};
+		template <typename Real> struct Fire  {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::Fire  (t, rgb, prof);}};
+		template <typename Real> struct Ocean {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::Ocean (t, rgb, prof);}};
+		template <typename Real> struct Ice   {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::Ice   (t, rgb, prof);}};
+		template <typename Real> struct Div   {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::Div   (t, rgb, prof);}};
+	}
+
+	namespace cyclic {
+		template <typename Real> struct Gray {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::GrayCy(t, rgb, prof);}};
+		template <typename Real> struct Four {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::FourCy(t, rgb, prof);}};
+		template <typename Real> struct Six  {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::SixCy (t, rgb, prof);}};
+		template <typename Real> struct Div  {template <Sym, bool> void operator()(const Real t, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::DivCy (t, rgb, prof);}};
+	}
+
+	namespace disk {
+		template <typename Real> struct Four {template <Sym S, bool W0, typename X> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::FourBi.template disk<S, W0>(x[0], x[1], rgb, prof);}};
+		template <typename Real> struct Six  {template <Sym S, bool W0, typename X> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::SixBi .template disk<S, W0>(x[0], x[1], rgb, prof);}};
+		template <typename Bicone> struct Adaptor {
+			const Bicone& bicone;//bicone to evaluate
+			template <Sym S, bool W0, typename X, typename Real> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {bicone.template disk<S, W0>(x[0], x[1], rgb, prof);}
+		};
+	}
+
+	namespace sphere {//the bicone member takes the polar angle first (same as sphere::four and sphere::six)
+		template <typename Real> struct Four {template <Sym S, bool W0, typename X> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::FourBi.template sphere<S, W0>(x[1], x[0], rgb, prof);}};
+		template <typename Real> struct Six  {template <Sym S, bool W0, typename X> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::SixBi .template sphere<S, W0>(x[1], x[0], rgb, prof);}};
+		template <typename Bicone> struct Adaptor {
+			const Bicone& bicone;//bicone to evaluate
+			template <Sym S, bool W0, typename X, typename Real> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {bicone.template sphere<S, W0>(x[1], x[0], rgb, prof);}
+		};
+	}
+
+	namespace ball {
+		template <typename Real> struct Four {template <Sym S, bool W0, typename X> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::FourBi.template ball<S, W0>(x[0], x[1], x[2], rgb, prof);}};
+		template <typename Real> struct Six  {template <Sym S, bool W0, typename X> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {detail::Maps<Real>::SixBi .template ball<S, W0>(x[0], x[1], x[2], rgb, prof);}};
+		template <typename Bicone> struct Adaptor {
+			const Bicone& bicone;//bicone to evaluate
+			template <Sym S, bool W0, typename X, typename Real> void operator()(const X& x, Real * const rgb, const color::Profile<Real>& prof) const {bicone.template ball<S, W0>(x[0], x[1], x[2], rgb, prof);}
+		};
+	}
+
+	//@brief      : color a range of coordinates with a map, symmetry, and center color fixed at compile time
+	//@param begin: iterator to first coordinate (tuple)
+	//@param end  : iterator past last coordinate (tuple)
+	//@param rgb  : location to write interleaved rgb colors (3 per coordinate)
+	//@param prof : rgb color space to write colors in
+	//@param map  : functor instance
+	template <typename Map, Sym S, bool W0, typename Iter, typename Real>
+	void colorize(Iter begin, const Iter end, Real * rgb, const color::Profile<Real>& prof, const Map& map) {
+		for(; begin != end; ++begin) {
+			map.template operator()<S, W0>(*begin, rgb, prof);//no symmetry switch, each (S, W0) is its own instantiation
+			rgb += 3;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//           Type Erased Color Map Implementations            //
+	////////////////////////////////////////////////////////////////
+
+	namespace detail {
+		//@brief: color map handle implemented by a pair of callables (so the per value calls inline into the batch loop)
+		template <typename Real, size_t D, typename Color, typename Color8>
+		class FunctorMap : public Colormap<Real, D> {
+			public:
+				//@brief       : construct a handle
+				//@param color : function to color a single value, void(Real const * const * const x, const size_t i, Real * const rgb) (rgb only)
+				//@param color8: function to color a batch of values, void(Real const * const * const x, const size_t n, uint8_t * const rgb) (including alpha)
+				//@param alpha : true/false to write rgba / rgb
+				FunctorMap(Color color, Color8 color8, const bool alpha) : Colormap<Real, D>(alpha), color(color), color8(color8) {}
+
+			private:
+				void colors(Real const * const * const x, const size_t n, uint8_t * const rgb) const override {color8(x, n, rgb);}
+				void colors(Real const * const * const x, const size_t n, Real    * const rgb) const override {
+					const size_t s = this->channels();
+					for(size_t i = 0; i < n; i++) color(x, i, rgb + s * i);
+					if(4 == s) for(size_t i = 0; i < n; i++) rgb[s * i + 3] = Real(1);
+				}
+
+				Color  color ;//single value color function
+				Color8 color8;//8 bit batch color function
+		};
+
+		//@brief       : wrap a pair of callables as a color map handle
+		//@param color : function to color a single value
+		//@param color8: function to color a batch of values
+		//@param alpha : true/false to write rgba / rgb
+		//@return      : handle
+		template <typename Real, size_t D, typename Color, typename Color8>
+		std::unique_ptr<const Colormap<Real, D> > makeMap(Color color, Color8 color8, const bool alpha) {
+			return std::unique_ptr<const Colormap<Real, D> >(new FunctorMap<Real, D, Color, Color8>(color, color8, alpha));
+		}
+
+		//@brief     : reject settings a run time map (addLut or addBicone) can't honor
+		//@param opts: settings to bind into the handle
+		//@note      : run time maps are floating point splines without a fixed point twin, Backend::Table falls back to Float like every other map without a table
+		template <typename Real> void checkRuntimeBackend(const MapOptions<Real>& opts) {
+			if(Backend::Fixed == opts.be) throw std::invalid_argument("the fixed point backend only applies to the predefined maps");
+		}
+
+		//@brief     : build a handle for a ramp or cyclic map from its function overloads (passed as template arguments so they are called directly)
+		//@param opts: settings to bind into the handle
+		//@return    : handle
+		template <typename Real, ramp::pfunc<Real> F, ramp::func8<Real> F8>
+		std::unique_ptr<const Colormap<Real, 1> > linearMap(const MapOptions<Real>& opts) {
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha;
+			const Backend be = opts.be;
+			return makeMap<Real, 1>(
+				[prof           ](Real const * const * const x, const size_t i, Real    * const rgb){F (x[0][i], rgb,           *prof    );},
+				[prof, alpha, be](Real const * const * const x, const size_t n, uint8_t * const rgb){F8(x[0]   , rgb, n, alpha, *prof, be);},
+				alpha);
+		}
+
+		//@brief     : build a handle for a disk or sphere map from its function overloads
+		//@param opts: settings to bind into the handle
+		//@return    : handle
+		template <typename Real, disk::pfunc<Real> F, disk::func8<Real> F8>
+		std::unique_ptr<const Colormap<Real, 2> > circMap(const MapOptions<Real>& opts) {
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha, w0 = opts.w0;
+			const Sym sym = opts.sym;
+			const Backend be = opts.be;
+			return makeMap<Real, 2>(
+				[prof, w0, sym           ](Real const * const * const x, const size_t i, Real    * const rgb){F (x[0][i], x[1][i], rgb,    w0, sym,        *prof    );},
+				[prof, w0, sym, alpha, be](Real const * const * const x, const size_t n, uint8_t * const rgb){F8(x[0]   , x[1]   , rgb, n, w0, sym, alpha, *prof, be);},
+				alpha);
+		}
+
+		//@brief     : build a handle for a predefined disk map (interpolating a cached table for the table backend)
+		//@param opts: settings to bind into the handle
+		//@return    : handle
+		template <typename Real, disk::pfunc<Real> F, disk::func8<Real> F8>
+		std::unique_ptr<const Colormap<Real, 2> > diskMap(const MapOptions<Real>& opts) {
+			if(Backend::Table != opts.be) return circMap<Real, F, F8>(opts);
+			DiskLut<Real> const * const lut = &DiskLut<Real>::cached(F, opts.w0, opts.sym, *opts.prof);//cached tables live for the life of the program
+			const bool alpha = opts.alpha;
+			return makeMap<Real, 2>(
+				[lut       ](Real const * const * const x, const size_t i, Real    * const rgb){(*lut)(x[0][i], x[1][i], rgb          );},
+				[lut, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){(*lut)(x[0]   , x[1]   , rgb, n, alpha);},
+				alpha);
+		}
+
+		//@brief     : build a handle for a predefined sphere map (interpolating a cached cube map for the table backend)
+		//@param opts: settings to bind into the handle
+		//@return    : handle
+		template <typename Real, sphere::pfunc<Real> F, sphere::func8<Real> F8>
+		std::unique_ptr<const Colormap<Real, 2> > sphereMap(const MapOptions<Real>& opts) {
+			if(Backend::Table != opts.be) return circMap<Real, F, F8>(opts);
+			SphereLut<Real> const * const lut = &SphereLut<Real>::cached(F, opts.w0, opts.sym, *opts.prof);//cached tables live for the life of the program
+			const bool alpha = opts.alpha;
+			return makeMap<Real, 2>(
+				[lut       ](Real const * const * const x, const size_t i, Real    * const rgb){(*lut)(x[0][i], x[1][i], rgb          );},
+				[lut, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){(*lut)(x[0]   , x[1]   , rgb, n, alpha);},
+				alpha);
+		}
+
+		//@brief     : build a handle for a predefined ball map from its function overloads (interpolating a cached voxel table for the table backend)
+		//@param opts: settings to bind into the handle
+		//@return    : handle
+		template <typename Real, ball::pfunc<Real> F, ball::func8<Real> F8>
+		std::unique_ptr<const Colormap<Real, 3> > ballMap(const MapOptions<Real>& opts) {
+			if(Backend::Table == opts.be) {
+				BallLut<Real> const * const lut = &BallLut<Real>::cached(F, opts.w0, opts.sym, *opts.prof);//cached tables live for the life of the program
+				const bool alpha = opts.alpha;
+				return makeMap<Real, 3>(
+					[lut       ](Real const * const * const x, const size_t i, Real    * const rgb){(*lut)(x[0][i], x[1][i], x[2][i], rgb          );},
+					[lut, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){(*lut)(x[0]   , x[1]   , x[2]   , rgb, n, alpha);},
+					alpha);
+			}
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha, w0 = opts.w0;
+			const Sym sym = opts.sym;
+			const Backend be = opts.be;
+			return makeMap<Real, 3>(
+				[prof, w0, sym           ](Real const * const * const x, const size_t i, Real    * const rgb){F (x[0][i], x[1][i], x[2][i], rgb,    w0, sym,        *prof    );},
+				[prof, w0, sym, alpha, be](Real const * const * const x, const size_t n, uint8_t * const rgb){F8(x[0]   , x[1]   , x[2]   , rgb, n, w0, sym, alpha, *prof, be);},
+				alpha);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//                 Registry Member Functions                  //
+	////////////////////////////////////////////////////////////////
+
+	//@brief : get the registry of ramps
+	//@return: registry holding the predefined ramps (plus anything added)
+	template <typename Real, size_t D>
+	Registry<Real, D>& Registry<Real, D>::ramps() {
+		static_assert(1 == D, "ramps have a single coordinate");
+		static Registry reg;
+		static std::once_flag flag;
+		std::call_once(flag, [](){
+			reg.add("gray" , detail::linearMap<Real, ramp::gray <Real>, ramp::gray <Real> >);
+			reg.add("fire" , detail::linearMap<Real, ramp::fire <Real>, ramp::fire <Real> >);
+			reg.add("ocean", detail::linearMap<Real, ramp::ocean<Real>, ramp::ocean<Real> >);
+			reg.add("ice"  , detail::linearMap<Real, ramp::ice  <Real>, ramp::ice  <Real> >);
+			reg.add("div"  , detail::linearMap<Real, ramp::div  <Real>, ramp::div  <Real> >);
+			reg.add("l01"  , detail::linearMap<Real, ramp::cet<Real, CET::L01 >, ramp::cet<Real, CET::L01 > >);
+			reg.add("l02"  , detail::linearMap<Real, ramp::cet<Real, CET::L02 >, ramp::cet<Real, CET::L02 > >);
+			reg.add("l03"  , detail::linearMap<Real, ramp::cet<Real, CET::L03 >, ramp::cet<Real, CET::L03 > >);
+			reg.add("l04"  , detail::linearMap<Real, ramp::cet<Real, CET::L04 >, ramp::cet<Real, CET::L04 > >);
+			reg.add("l05"  , detail::linearMap<Real, ramp::cet<Real, CET::L05 >, ramp::cet<Real, CET::L05 > >);
+			reg.add("l06"  , detail::linearMap<Real, ramp::cet<Real, CET::L06 >, ramp::cet<Real, CET::L06 > >);
+			reg.add("l07"  , detail::linearMap<Real, ramp::cet<Real, CET::L07 >, ramp::cet<Real, CET::L07 > >);
+			reg.add("l08"  , detail::linearMap<Real, ramp::cet<Real, CET::L08 >, ramp::cet<Real, CET::L08 > >);
+			reg.add("l09"  , detail::linearMap<Real, ramp::cet<Real, CET::L09 >, ramp::cet<Real, CET::L09 > >);
+			reg.add("l10"  , detail::linearMap<Real, ramp::cet<Real, CET::L10 >, ramp::cet<Real, CET::L10 > >);
+			reg.add("l11"  , detail::linearMap<Real, ramp::cet<Real, CET::L11 >, ramp::cet<Real, CET::L11 > >);
+			reg.add("l12"  , detail::linearMap<Real, ramp::cet<Real, CET::L12 >, ramp::cet<Real, CET::L12 > >);
+			reg.add("l13"  , detail::linearMap<Real, ramp::cet<Real, CET::L13 >, ramp::cet<Real, CET::L13 > >);
+			reg.add("l14"  , detail::linearMap<Real, ramp::cet<Real, CET::L14 >, ramp::cet<Real, CET::L14 > >);
+			reg.add("l15"  , detail::linearMap<Real, ramp::cet<Real, CET::L15 >, ramp::cet<Real, CET::L15 > >);
+			reg.add("l16"  , detail::linearMap<Real, ramp::cet<Real, CET::L16 >, ramp::cet<Real, CET::L16 > >);
+			reg.add("l17"  , detail::linearMap<Real, ramp::cet<Real, CET::L17 >, ramp::cet<Real, CET::L17 > >);
+			reg.add("l18"  , detail::linearMap<Real, ramp::cet<Real, CET::L18 >, ramp::cet<Real, CET::L18 > >);
+			reg.add("l19"  , detail::linearMap<Real, ramp::cet<Real, CET::L19 >, ramp::cet<Real, CET::L19 > >);
+			reg.add("l20"  , detail::linearMap<Real, ramp::cet<Real, CET::L20 >, ramp::cet<Real, CET::L20 > >);
+			reg.add("d01"  , detail::linearMap<Real, ramp::cet<Real, CET::D01 >, ramp::cet<Real, CET::D01 > >);
+			reg.add("d01a" , detail::linearMap<Real, ramp::cet<Real, CET::D01A>, ramp::cet<Real, CET::D01A> >);
+			reg.add("d02"  , detail::linearMap<Real, ramp::cet<Real, CET::D02 >, ramp::cet<Real, CET::D02 > >);
+			reg.add("d03"  , detail::linearMap<Real, ramp::cet<Real, CET::D03 >, ramp::cet<Real, CET::D03 > >);
+			reg.add("d04"  , detail::linearMap<Real, ramp::cet<Real, CET::D04 >, ramp::cet<Real, CET::D04 > >);
+			reg.add("d06"  , detail::linearMap<Real, ramp::cet<Real, CET::D06 >, ramp::cet<Real, CET::D06 > >);
+			reg.add("d07"  , detail::linearMap<Real, ramp::cet<Real, CET::D07 >, ramp::cet<Real, CET::D07 > >);
+			reg.add("d08"  , detail::linearMap<Real, ramp::cet<Real, CET::D08 >, ramp::cet<Real, CET::D08 > >);
+			reg.add("d09"  , detail::linearMap<Real, ramp::cet<Real, CET::D09 >, ramp::cet<Real, CET::D09 > >);
+			reg.add("d10"  , detail::linearMap<Real, ramp::cet<Real, CET::D10 >, ramp::cet<Real, CET::D10 > >);
+			reg.add("d11"  , detail::linearMap<Real, ramp::cet<Real, CET::D11 >, ramp::cet<Real, CET::D11 > >);
+			reg.add("d12"  , detail::linearMap<Real, ramp::cet<Real, CET::D12 >, ramp::cet<Real, CET::D12 > >);
+			reg.add("d13"  , detail::linearMap<Real, ramp::cet<Real, CET::D13 >, ramp::cet<Real, CET::D13 > >);
+			reg.add("r1"   , detail::linearMap<Real, ramp::cet<Real, CET::R1  >, ramp::cet<Real, CET::R1  > >);
+			reg.add("r2"   , detail::linearMap<Real, ramp::cet<Real, CET::R2  >, ramp::cet<Real, CET::R2  > >);
+			reg.add("r3"   , detail::linearMap<Real, ramp::cet<Real, CET::R3  >, ramp::cet<Real, CET::R3  > >);
+			reg.add("r4"   , detail::linearMap<Real, ramp::cet<Real, CET::R4  >, ramp::cet<Real, CET::R4  > >);
+			reg.add("i1"   , detail::linearMap<Real, ramp::cet<Real, CET::I1  >, ramp::cet<Real, CET::I1  > >);
+			reg.add("i2"   , detail::linearMap<Real, ramp::cet<Real, CET::I2  >, ramp::cet<Real, CET::I2  > >);
+			reg.add("i3"   , detail::linearMap<Real, ramp::cet<Real, CET::I3  >, ramp::cet<Real, CET::I3  > >);
+			reg.add("cbl1" , detail::linearMap<Real, ramp::cet<Real, CET::CBL1>, ramp::cet<Real, CET::CBL1> >);
+			reg.add("cbl2" , detail::linearMap<Real, ramp::cet<Real, CET::CBL2>, ramp::cet<Real, CET::CBL2> >);
+			reg.add("cbd1" , detail::linearMap<Real, ramp::cet<Real, CET::CBD1>, ramp::cet<Real, CET::CBD1> >);
+		});
+		return reg;
+	}
+
+	//@brief : get the registry of cyclic maps
+	//@return: registry holding the predefined cyclic maps (plus anything added)
+	template <typename Real, size_t D>
+	Registry<Real, D>& Registry<Real, D>::cycles() {
+		static_assert(1 == D, "cyclic maps have a single coordinate");
+		static Registry reg;
+		static std::once_flag flag;
+		std::call_once(flag, [](){
+			reg.add("gray", detail::linearMap<Real, cyclic::gray <Real>, cyclic::gray <Real> >);
+			reg.add("four", detail::linearMap<Real, cyclic::four <Real>, cyclic::four <Real> >);
+			reg.add("six" , detail::linearMap<Real, cyclic::six  <Real>, cyclic::six  <Real> >);
+			reg.add("div" , detail::linearMap<Real, cyclic::div  <Real>, cyclic::div  <Real> >);
+			reg.add("c1"  , detail::linearMap<Real, cyclic::cet<Real, CET::C1  >, cyclic::cet<Real, CET::C1  > >);
+			reg.add("c2"  , detail::linearMap<Real, cyclic::cet<Real, CET::C2  >, cyclic::cet<Real, CET::C2  > >);
+			reg.add("c3"  , detail::linearMap<Real, cyclic::cet<Real, CET::C3  >, cyclic::cet<Real, CET::C3  > >);
+			reg.add("c4"  , detail::linearMap<Real, cyclic::cet<Real, CET::C4  >, cyclic::cet<Real, CET::C4  > >);
+			reg.add("c5"  , detail::linearMap<Real, cyclic::cet<Real, CET::C5  >, cyclic::cet<Real, CET::C5  > >);
+			reg.add("c6"  , detail::linearMap<Real, cyclic::cet<Real, CET::C6  >, cyclic::cet<Real, CET::C6  > >);
+			reg.add("c7"  , detail::linearMap<Real, cyclic::cet<Real, CET::C7  >, cyclic::cet<Real, CET::C7  > >);
+			reg.add("cbc1", detail::linearMap<Real, cyclic::cet<Real, CET::CBC1>, cyclic::cet<Real, CET::CBC1> >);
+			reg.add("cbc2", detail::linearMap<Real, cyclic::cet<Real, CET::CBC2>, cyclic::cet<Real, CET::CBC2> >);
+		});
+		return reg;
+	}
+
+	//@brief : get the registry of disk maps
+	//@return: registry holding the predefined disk maps (plus anything added)
+	template <typename Real, size_t D>
+	Registry<Real, D>& Registry<Real, D>::disks() {
+		static_assert(2 == D, "disk maps have two coordinates");
+		static Registry reg;
+		static std::once_flag flag;
+		std::call_once(flag, [](){
+			reg.add("four", detail::diskMap<Real, disk::four<Real>, disk::four<Real> >);
+			reg.add("six" , detail::diskMap<Real, disk::six <Real>, disk::six <Real> >);
+		});
+		return reg;
+	}
+
+	//@brief : get the registry of sphere maps
+	//@return: registry holding the predefined sphere maps (plus anything added)
+	template <typename Real, size_t D>
+	Registry<Real, D>& Registry<Real, D>::spheres() {
+		static_assert(2 == D, "sphere maps have two coordinates");
+		static Registry reg;
+		static std::once_flag flag;
+		std::call_once(flag, [](){
+			reg.add("four", detail::sphereMap<Real, sphere::four<Real>, sphere::four<Real> >);
+			reg.add("six" , detail::sphereMap<Real, sphere::six <Real>, sphere::six <Real> >);
+		});
+		return reg;
+	}
+
+	//@brief : get the registry of ball maps
+	//@return: registry holding the predefined ball maps (plus anything added)
+	template <typename Real, size_t D>
+	Registry<Real, D>& Registry<Real, D>::balls() {
+		static_assert(3 == D, "ball maps have three coordinates");
+		static Registry reg;
+		static std::once_flag flag;
+		std::call_once(flag, [](){
+			reg.add("four", detail::ballMap<Real, ball::four<Real>, ball::four<Real> >);
+			reg.add("six" , detail::ballMap<Real, ball::six <Real>, ball::six <Real> >);
+		});
+		return reg;
+	}
+
+	//@brief        : add a color map (thread safe)
+	//@param name   : name to build map by (an existing map with the same name is replaced)
+	//@param factory: function to build a handle for the map
+	template <typename Real, size_t D>
+	void Registry<Real, D>::add(const std::string& name, Factory factory) {
+		std::lock_guard<std::mutex> lock(mut);
+		for(std::pair<std::string, Factory>& e : entries) {
+			if(name == e.first) {
+				e.second = factory;
+				return;
+			}
+		}
+		entries.emplace_back(name, factory);
+	}
+
+	//@brief     : build a handle by name (thread safe)
+	//@param name: name of map
+	//@param opts: settings to bind into the handle
+	//@return    : handle (or NULL if there is no map with the name)
+	template <typename Real, size_t D>
+	std::unique_ptr<const Colormap<Real, D> > Registry<Real, D>::make(const std::string& name, const MapOptions<Real>& opts) const {
+		Factory factory;
+		{
+			std::lock_guard<std::mutex> lock(mut);
+			for(const std::pair<std::string, Factory>& e : entries) if(name == e.first) factory = e.second;
+		}
+		return factory ? factory(opts) : std::unique_ptr<const Colormap<Real, D> >();//build outside of the lock
+	}
+
+	//@brief : get the names of all maps in the registry
+	//@return: names in the order they were added
+	template <typename Real, size_t D>
+	std::vector<std::string> Registry<Real, D>::names() const {
+		std::lock_guard<std::mutex> lock(mut);
+		std::vector<std::string> n;
+		for(const std::pair<std::string, Factory>& e : entries) n.push_back(e.first);
+		return n;
+	}
+
+	//@brief     : add a run time ramp or cyclic map to the ramp or cyclic registry (selected by lut->cyclic())
+	//@param name: name to build map by
+	//@param lut : map to add (shared with the handles built from it)
+	template <typename Real>
+	void addLut(const std::string& name, std::shared_ptr<const DynamicLut<Real> > lut) {
+		Registry<Real, 1>& reg = lut->cyclic() ? Registry<Real, 1>::cycles() : Registry<Real, 1>::ramps();
+		reg.add(name, [lut](const MapOptions<Real>& opts){
+			detail::checkRuntimeBackend(opts);
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha;
+			return detail::makeMap<Real, 1>(
+				[lut, prof       ](Real const * const * const x, const size_t i, Real    * const rgb){(*lut)(x[0][i], rgb,           *prof);},
+				[lut, prof, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){(*lut)(x[0]   , rgb, n, alpha, *prof);},
+				alpha);
+		});
+	}
+
+	//@brief       : add a run time bicone to the disk, sphere, and ball registries
+	//@param name  : name to build maps by
+	//@param bicone: bicone to add (shared with the handles built from it)
+	template <typename Real>
+	void addBicone(const std::string& name, std::shared_ptr<const DynamicBicone<Real> > bicone) {
+		//the coordinates are passed in the same order as the predefined disk::*, sphere::*, and ball::* functions
+		Registry<Real, 2>::disks().add(name, [bicone](const MapOptions<Real>& opts){
+			detail::checkRuntimeBackend(opts);
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha, w0 = opts.w0;
+			const Sym sym = opts.sym;
+			return detail::makeMap<Real, 2>(
+				[bicone, prof, w0, sym       ](Real const * const * const x, const size_t i, Real    * const rgb){bicone->disk(x[0][i], x[1][i], rgb,    w0, sym,        *prof);},
+				[bicone, prof, w0, sym, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){bicone->disk(x[0]   , x[1]   , rgb, n, w0, sym, alpha, *prof);},
+				alpha);
+		});
+		Registry<Real, 2>::spheres().add(name, [bicone](const MapOptions<Real>& opts){
+			detail::checkRuntimeBackend(opts);
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha, w0 = opts.w0;
+			const Sym sym = opts.sym;
+			return detail::makeMap<Real, 2>(
+				[bicone, prof, w0, sym       ](Real const * const * const x, const size_t i, Real    * const rgb){bicone->sphere(x[1][i], x[0][i], rgb,    w0, sym,        *prof);},
+				[bicone, prof, w0, sym, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){bicone->sphere(x[1]   , x[0]   , rgb, n, w0, sym, alpha, *prof);},
+				alpha);
+		});
+		Registry<Real, 3>::balls().add(name, [bicone](const MapOptions<Real>& opts){
+			detail::checkRuntimeBackend(opts);
+			color::Profile<Real> const * const prof = opts.prof;
+			const bool alpha = opts.alpha, w0 = opts.w0;
+			const Sym sym = opts.sym;
+			return detail::makeMap<Real, 3>(
+				[bicone, prof, w0, sym       ](Real const * const * const x, const size_t i, Real    * const rgb){bicone->ball(x[0][i], x[1][i], x[2][i], rgb,    w0, sym,        *prof);},
+				[bicone, prof, w0, sym, alpha](Real const * const * const x, const size_t n, uint8_t * const rgb){bicone->ball(x[0]   , x[1]   , x[2]   , rgb, n, w0, sym, alpha, *prof);},
+				alpha);
+		});
+	}
+
 	////////////////////////////////////////////////////////////////
 	//         Legend Generation Function Implementations         //
 	////////////////////////////////////////////////////////////////
@@ -855,8 +3779,10 @@ namespace colormap {
 				}
 			}
 		} else {//for flat every row is the same
-			for(size_t i = 0; i < W; i++) {//loop first row computing color
-				ramp(Real(i) / (W - 1) , color);//compute color
+			std::vector<Real> row(W * 3);
+			ramp::sweep(ramp, row.data(), W);//compute first row of colors at once
+			for(size_t i = 0; i < W; i++) {//loop first row adding alpha if needed
+				std::copy(row.begin() + 3 * i, row.begin() + 3 * i + 3, color);
 				std::copy(color, color + stride, rgb + stride * i);//copy to output
 			}
 			for(size_t j = 1; j < H; j++) std::copy(rgb, rgb + W * stride, rgb + j * W * stride);//copy first row to the rest
@@ -958,6 +3884,7 @@ namespace colormap {
 			case Projection::Stereo : unproject = [](const Real& r)->Real{return Real(0) == r ? 0 : Real(1) - std::atan( Real(1) / r ) * 2 / M_PI;}; break;//stereographic projection
 			case Projection::Lambert: unproject = [](const Real& r)->Real{return Real(1) - std::acos(r / std::sqrt(2)) * Real(2) / M_PI          ;}; break;//lambert equal area modified for pi()/2 projects -> 1
 			case Projection::Dist   : unproject = [](const Real& r)->Real{return r / 2                                                           ;}; break;//equal distance
+			default: throw std::invalid_argument("unknown projection");
 		}
 
 		Real color[4] = {0, 0, 0, 1};//set alpha channel to 1
@@ -988,8 +3915,58 @@ namespace colormap {
 		}
 	}
 
+	namespace detail {
+		//@brief        : create an rgb or rgba legend for a ball color map
+		//@param color  : callable computing the rgb color of a fractional spherical coordinate as color(r, a, p, rgb)
+		//@param rgb    : location to write legend image data
+		//@param rRipple: magnitude of ripple in radial direction
+		//@param pRipple: magnitude of ripple in polar direction
+		//@param aRipple: magnitude of ripple in azimuthal direction
+		//@param alpha  : true/false to include an alpha channel
+		//@param WH     : width/height/depth of color bar in pixels
+		//@param vFill  : value to use for background
+		//@param N      : number of sine waves from p = 0->1 and a = 0->0.5 (ignored for ripple = false)
+		template <typename Real, typename Color>
+		void ballLegend(Color color, Real * const rgb, const Real rRipple, const Real pRipple, const Real aRipple, const bool alpha, const size_t WH, const Real vFill, const size_t N) {
+			Real pix[4] = {0, 0, 0, 1};//set alpha channel to 1
+			const size_t stride = alpha ? 4 : 3;//is this an rgb or an rgba image
+			const bool radialRipple  = rRipple != Real(0);//does a radial ripple need to be applied
+			const bool polarRipple   = pRipple != Real(0);//does a theta  ripple need to be applied
+			const bool azimuthRipple = aRipple != Real(0);//does a radial ripple need to be applied
+			for(size_t k = 0; k < WH; k++) {//loop over rows
+				const Real z = Real(k) / (WH - 1) * 2 - 1;//[-1,1]
+				const Real zz = z * z;
+				const size_t offsetK = k * WH * WH * stride;//offset to slice start
+				for(size_t j = 0; j < WH; j++) {//loop over rows
+					const size_t offset = offsetK + WH * stride * j;
+					const Real y = Real(j) / (WH - 1) * 2 - 1;//[-1,1]
+					const Real yy_zz = y * y + z * z;
+					for(size_t i = 0; i < WH; i++) {//loop over columns
+						const Real x = Real(i) / (WH - 1) * 2 - 1;//[-1,1]
+						const Real r2 = x * x + yy_zz;
+						const size_t idx = offset + stride * i;//compute pixel index
+						if(r2 <= Real(1)) {//compute color
+							//convert from cartesian to fractional sphereical
+							Real r = std::sqrt(r2);
+							Real p = std::acos(z / r) / M_PI;
+							Real a = std::atan2(y, x) / (M_PI * 2);//azimuthal angle [-0.5,0.5]
+							if(std::signbit(a)) a += Real(1);//azimuthal angle [0,1]
+							if(radialRipple ) r = testSignal(r, false, N / 2, rRipple);//apply r ripple
+							if(polarRipple  ) p = testSignal(p, false, N    , pRipple);//apply p ripple
+							if(azimuthRipple) a = testSignal(a, true , N * 2, aRipple);//apply a ripple
+							color(r, a, p, pix);//compute color
+							std::copy(pix, pix + stride, rgb + idx);//copy to output
+						} else {//background
+							std::fill(rgb + idx, rgb + idx + stride, 4 == stride ? 0 : vFill);
+						}
+					}
+				}
+			}
+		}
+	}
+
 	//@brief        : create an rgb or rgba legend for a ball color map
-	//@param ball    : color map function to use
+	//@param ball   : color map function to use
 	//@param rgb    : location to write legend image data
 	//@param w0     : true/false for white/black center
 	//@param sym    : type of symmetry to apply
@@ -1001,40 +3978,21 @@ namespace colormap {
 	//@param vFill  : value to use for background
 	//@param N      : number of sine waves from p = 0->1 and a = 0->0.5 (ignored for ripple = false)
 	template <typename Real> void ball::legend(ball::func<Real> ball, Real * const rgb, const bool w0, const Sym sym, const Real rRipple, const Real pRipple, const Real aRipple, const bool alpha, const size_t WH, const Real vFill, const size_t N) {
-		Real color[4] = {0, 0, 0, 1};//set alpha channel to 1
-		const size_t stride = alpha ? 4 : 3;//is this an rgb or an rgba image
-		const bool radialRipple  = rRipple != Real(0);//does a radial ripple need to be applied
-		const bool polarRipple   = pRipple != Real(0);//does a theta  ripple need to be applied
-		const bool azimuthRipple = aRipple != Real(0);//does a radial ripple need to be applied
-		for(size_t k = 0; k < WH; k++) {//loop over rows
-			const Real z = Real(k) / (WH - 1) * 2 - 1;//[-1,1]
-			const Real zz = z * z;
-			const size_t offsetK = k * WH * WH * stride;//offset to slice start
-			for(size_t j = 0; j < WH; j++) {//loop over rows
-				const size_t offset = offsetK + WH * stride * j;
-				const Real y = Real(j) / (WH - 1) * 2 - 1;//[-1,1]
-				const Real yy_zz = y * y + z * z;
-				for(size_t i = 0; i < WH; i++) {//loop over columns
-					const Real x = Real(i) / (WH - 1) * 2 - 1;//[-1,1]
-					const Real r2 = x * x + yy_zz;
-					const size_t idx = offset + stride * i;//compute pixel index
-					if(r2 <= Real(1)) {//compute color
-						//convert from cartesian to fractional sphereical
-						Real r = std::sqrt(r2);
-						Real p = std::acos(z / r) / M_PI;
-						Real a = std::atan2(y, x) / (M_PI * 2);//azimuthal angle [-0.5,0.5]
-						if(std::signbit(a)) a += Real(1);//azimuthal angle [0,1]
-						if(radialRipple ) r = detail::testSignal(r, false, N / 2, rRipple);//apply r ripple
-						if(polarRipple  ) p = detail::testSignal(p, false, N    , pRipple);//apply p ripple
-						if(azimuthRipple) a = detail::testSignal(a, true , N * 2, aRipple);//apply a ripple
-						ball(r, a, p, color, w0, sym);//compute color
-						std::copy(color, color + stride, rgb + idx);//copy to output
-					} else {//background
-						std::fill(rgb + idx, rgb + idx + stride, 4 == stride ? 0 : vFill);
-					}
-				}
-			}
-		}
+		detail::ballLegend([ball, w0, sym](const Real r, const Real a, const Real p, Real * const c){ball(r, a, p, c, w0, sym);}, rgb, rRipple, pRipple, aRipple, alpha, WH, vFill, N);
+	}
+
+	//@brief        : create an rgb or rgba legend by interpolating a baked ball color map
+	//@param lut    : baked color map to use (center color and symmetry are fixed by the table)
+	//@param rgb    : location to write legend image data
+	//@param rRipple: magnitude of ripple in radial direction
+	//@param pRipple: magnitude of ripple in polar direction
+	//@param aRipple: magnitude of ripple in azimuthal direction
+	//@param alpha  : true/false to include an alpha channel
+	//@param WH     : width/height/depth of color bar in pixels
+	//@param vFill  : value to use for background
+	//@param N      : number of sine waves from p = 0->1 and a = 0->0.5 (ignored for ripple = false)
+	template <typename Real> void ball::legend(const BallLut<Real>& lut, Real * const rgb, const Real rRipple, const Real pRipple, const Real aRipple, const bool alpha, const size_t WH, const Real vFill, const size_t N) {
+		detail::ballLegend([&lut](const Real r, const Real a, const Real p, Real * const c){lut(r, a, p, c);}, rgb, rRipple, pRipple, aRipple, alpha, WH, vFill, N);
 	}
 }//namespace colormap
 
@@ -36,8 +36,26 @@
 #include <cmath>
 #include <numeric>
 #include <algorithm>
+#include <vector>
+#include <limits>//numeric_limits
+#include <cstdint>//int32_t, uint64_t
+#include <cstring>//memcpy
+#include <memory>//shared_ptr
+
+//@note: requires c++14 (the sRGB matrices are evaluated at compile time)
+
+#if !defined(_MSVC_LANG) && __cplusplus < 201402L//msvc only reports the standard in __cplusplus with /Zc:__cplusplus
+	#error "colorspace.hpp requires c++14 or newer"
+#endif
 
 namespace color {
+	//evaluation strategy for rgb transfer functions (gamma correction) in conversions to/from rgb
+	enum class Gamma {
+		Exact,//std::pow (reference implementation)
+		Fast ,//polynomial approximations of log2 and exp2 (see detail::Transfer for error bounds), fastest when batched loops vectorize (-O3, any x86-64 for float, AVX-512 for double)
+		Table,//linear interpolation of a high resolution lookup table (see detail::Transfer for error bounds), fastest for single colors or builds that don't vectorize (e.g. gcc -O2)
+	};
+
 	//@brief: color space conversion functions abc2ijk where abc/ijk are two of
 	// -rgb, {r , g , b }: standard red, green, blue (sRGB)
 	// -xyz, {X , Y , Z }: CIE 1931 XYZ color space ['master' (original) perceptually uniform color space]
@@ -60,26 +78,27 @@ namespace color {
 	//@param abc: values to convert from abc color space
 	//@param ijk: location to write values converted to ijk color space (can be the same as parameter abc)
 	//@param ill: standard illuminant as xyz (only required for conversions involving xyz<->luv or xyz<->lab, defaults to CIE illuminant D65 for 2 degree observer)
+	//@param gam: evaluation strategy for the sRGB transfer function (only available for direct conversions between rgb and cie spaces)
 	//@return: true/false if the values fall outside the ijk gamut for conversions to that pass through xyz2rgb (void for others)
-	template <typename T> void rgb2xyz(T const * const rgb, T * const xyz                      );
-	template <typename T> void rgb2luv(T const * const rgb, T * const luv, T const * ill = NULL);
-	template <typename T> void rgb2lab(T const * const rgb, T * const lab, T const * ill = NULL);
+	template <typename T> void rgb2xyz(T const * const rgb, T * const xyz,                       const Gamma gam = Gamma::Exact);
+	template <typename T> void rgb2luv(T const * const rgb, T * const luv, T const * ill = NULL, const Gamma gam = Gamma::Exact);
+	template <typename T> void rgb2lab(T const * const rgb, T * const lab, T const * ill = NULL, const Gamma gam = Gamma::Exact);
 	template <typename T> void rgb2hsv(T const * const rgb, T * const hsv                      );
 	template <typename T> void rgb2hsl(T const * const rgb, T * const hsl                      );
 
-	template <typename T> bool xyz2rgb(T const * const xyz, T * const rgb                      );
+	template <typename T> bool xyz2rgb(T const * const xyz, T * const rgb,                       const Gamma gam = Gamma::Exact);
 	template <typename T> void xyz2luv(T const * const xyz, T * const luv, T const * ill = NULL);
 	template <typename T> void xyz2lab(T const * const xyz, T * const lab, T const * ill = NULL);
 	template <typename T> bool xyz2hsv(T const * const xyz, T * const hsv                      );
 	template <typename T> bool xyz2hsl(T const * const xyz, T * const hsl                      );
 
-	template <typename T> bool luv2rgb(T const * const luv, T * const rgb, T const * ill = NULL);
+	template <typename T> bool luv2rgb(T const * const luv, T * const rgb, T const * ill = NULL, const Gamma gam = Gamma::Exact);
 	template <typename T> void luv2xyz(T const * const luv, T * const xyz, T const * ill = NULL);
 	template <typename T> void luv2lab(T const * const luv, T * const lab, T const * ill = NULL);
 	template <typename T> bool luv2hsv(T const * const luv, T * const hsv, T const * ill = NULL);
 	template <typename T> bool luv2hsl(T const * const luv, T * const hsl, T const * ill = NULL);
 
-	template <typename T> bool lab2rgb(T const * const lab, T * const rgb, T const * ill = NULL);
+	template <typename T> bool lab2rgb(T const * const lab, T * const rgb, T const * ill = NULL, const Gamma gam = Gamma::Exact);
 	template <typename T> void lab2xyz(T const * const lab, T * const xyz, T const * ill = NULL);
 	template <typename T> void lab2luv(T const * const lab, T * const luv, T const * ill = NULL);
 	template <typename T> bool lab2hsv(T const * const lab, T * const hsv, T const * ill = NULL);
@@ -97,10 +116,204 @@ namespace color {
 	template <typename T> void hsl2lab(T const * const hsl, T * const lab, T const * ill = NULL);
 	template <typename T> void hsl2hsv(T const * const hsl, T * const hsv                      );
 
+	//memory layout of arrays of colors for batched conversions
+	enum class Layout {
+		Interleaved,//{a0, b0, c0, a1, b1, c1, ...} (array of structures, e.g. an rgb image)
+		Planar     ,//{a0, a1, ..., b0, b1, ..., c0, c1, ...} (structure of arrays, e.g. separate channel images)
+	};
+
+	//@brief: batched versions of the above conversions for arrays of n colors
+	//@param abc   : n values to convert from abc color space
+	//@param ijk   : location to write n values converted to ijk color space (can be the same as parameter abc)
+	//@param n     : number of colors to convert
+	//@param layout: memory layout of abc and ijk (for Layout::Planar each channel is a contiguous array of n values)
+	//@param ill   : standard illuminant as xyz (only required for conversions involving xyz<->luv or xyz<->lab, defaults to CIE illuminant D65 for 2 degree observer)
+	//@param gam   : evaluation strategy for the sRGB transfer function (only available for direct conversions between rgb and cie spaces)
+	//@return: true/false if any value falls outside the ijk gamut for conversions to that pass through xyz2rgb (void for others)
+	//@note: colors are converted in blocks of detail::BatchSize, with each step of the network above applied to an entire block
+	//       as a branch free loop over planar data so the compiler can vectorize it for the target instruction set (SSE/AVX2/AVX-512)
+	//@note: results match the scalar functions to within 2e-5 (float) / 1e-13 (double) of the output range ([0,1] for rgb/hsv/hsl/xyz, [0,100] for L*)
+	//       differences only come from hoisted constants and contraction into fused multiply adds (luv -> xyz divides by v' which amplifies them for saturated colors)
+	//@note: with the default Release build (-O3) float conversions vectorize on any x86-64 cpu, double conversions only vectorize their cube roots and
+	//       transfer functions with AVX-512 (see the README for measured speedups), std::pow is never vectorized so Gamma::Exact gains the least
+	template <typename T> void rgb2xyz(T const * const rgb, T * const xyz, const size_t n, const Layout layout,                       const Gamma gam = Gamma::Exact);
+	template <typename T> void rgb2luv(T const * const rgb, T * const luv, const size_t n, const Layout layout, T const * ill = NULL, const Gamma gam = Gamma::Exact);
+	template <typename T> void rgb2lab(T const * const rgb, T * const lab, const size_t n, const Layout layout, T const * ill = NULL, const Gamma gam = Gamma::Exact);
+	template <typename T> void rgb2hsv(T const * const rgb, T * const hsv, const size_t n, const Layout layout                      );
+	template <typename T> void rgb2hsl(T const * const rgb, T * const hsl, const size_t n, const Layout layout                      );
+
+	template <typename T> bool xyz2rgb(T const * const xyz, T * const rgb, const size_t n, const Layout layout,                       const Gamma gam = Gamma::Exact);
+	template <typename T> void xyz2luv(T const * const xyz, T * const luv, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void xyz2lab(T const * const xyz, T * const lab, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> bool xyz2hsv(T const * const xyz, T * const hsv, const size_t n, const Layout layout                      );
+	template <typename T> bool xyz2hsl(T const * const xyz, T * const hsl, const size_t n, const Layout layout                      );
+
+	template <typename T> bool luv2rgb(T const * const luv, T * const rgb, const size_t n, const Layout layout, T const * ill = NULL, const Gamma gam = Gamma::Exact);
+	template <typename T> void luv2xyz(T const * const luv, T * const xyz, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void luv2lab(T const * const luv, T * const lab, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> bool luv2hsv(T const * const luv, T * const hsv, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> bool luv2hsl(T const * const luv, T * const hsl, const size_t n, const Layout layout, T const * ill = NULL);
+
+	template <typename T> bool lab2rgb(T const * const lab, T * const rgb, const size_t n, const Layout layout, T const * ill = NULL, const Gamma gam = Gamma::Exact);
+	template <typename T> void lab2xyz(T const * const lab, T * const xyz, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void lab2luv(T const * const lab, T * const luv, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> bool lab2hsv(T const * const lab, T * const hsv, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> bool lab2hsl(T const * const lab, T * const hsl, const size_t n, const Layout layout, T const * ill = NULL);
+
+	template <typename T> void hsv2rgb(T const * const hsv, T * const rgb, const size_t n, const Layout layout                      );
+	template <typename T> void hsv2xyz(T const * const hsv, T * const xyz, const size_t n, const Layout layout                      );
+	template <typename T> void hsv2luv(T const * const hsv, T * const luv, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void hsv2lab(T const * const hsv, T * const lab, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void hsv2hsl(T const * const hsv, T * const hsl, const size_t n, const Layout layout                      );
+
+	template <typename T> void hsl2rgb(T const * const hsl, T * const rgb, const size_t n, const Layout layout                      );
+	template <typename T> void hsl2xyz(T const * const hsl, T * const xyz, const size_t n, const Layout layout                      );
+	template <typename T> void hsl2luv(T const * const hsl, T * const luv, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void hsl2lab(T const * const hsl, T * const lab, const size_t n, const Layout layout, T const * ill = NULL);
+	template <typename T> void hsl2hsv(T const * const hsl, T * const hsv, const size_t n, const Layout layout                      );
+
+	//@brief: batched conversions from integer (8 or 16 bit) sRGB to cie spaces (e.g. for analysis of already colored images)
+	//@param rgb   : n sRGB values to convert ([0,255] for uint8_t, [0,65535] for uint16_t)
+	//@param ijk   : location to write n values converted to ijk color space (always 3 channels)
+	//@param n     : number of colors to convert
+	//@param layout: memory layout of rgb and ijk
+	//@param ill   : standard illuminant as xyz (or NULL for CIE illuminant D65 for 2 degree observer)
+	//@param stride: distance between consecutive colors in rgb for Layout::Interleaved (e.g. 4 to skip an alpha channel)
+	//@note: channels are linearized with a table holding the exact linear value of every integer code (256 or 65536 entries constructed on first use)
+	//       so the transfer function is never evaluated and the only error is from the vectorizable cube root used by xyz2luv/xyz2lab
+	template <typename T> void rgb2xyz(uint8_t  const * const rgb, T * const xyz, const size_t n, const Layout layout,                       const size_t stride = 3);
+	template <typename T> void rgb2luv(uint8_t  const * const rgb, T * const luv, const size_t n, const Layout layout, T const * ill = NULL, const size_t stride = 3);
+	template <typename T> void rgb2lab(uint8_t  const * const rgb, T * const lab, const size_t n, const Layout layout, T const * ill = NULL, const size_t stride = 3);
+	template <typename T> void rgb2xyz(uint16_t const * const rgb, T * const xyz, const size_t n, const Layout layout,                       const size_t stride = 3);
+	template <typename T> void rgb2luv(uint16_t const * const rgb, T * const luv, const size_t n, const Layout layout, T const * ill = NULL, const size_t stride = 3);
+	template <typename T> void rgb2lab(uint16_t const * const rgb, T * const lab, const size_t n, const Layout layout, T const * ill = NULL, const size_t stride = 3);
+
+	namespace detail {
+		template <typename T> struct Transfer;//rgb transfer function (gamma curve)
+		template <typename T> struct Block   ;//planar working storage for batched conversions
+		template <typename T> class  Lattice ;//precomputed Luv -> rgb table
+	}
+
+	//@brief: precomputed constants for conversion between Luv/XYZ and an arbitrary rgb color space (gamut + white point + transfer function)
+	//@note : the conversion functions above are hard wired to sRGB, a profile fuses luv->xyz->linear rgb into a single matrix and
+	//        caches the white point constants and transfer function so they aren't recomputed for every color
+	template <typename T>
+	struct Profile {
+		public:
+			//@brief      : construct a profile for an rgb color space
+			//@param rgb  : chromaticity of {red point, green point, blue point} as xyz (e.g. detail::Standards<T>::adobeRGB)
+			//@param w    : chromaticity of rgb white point as xyz
+			//@param a    : deviation of gamma correction coefficient from 1
+			//@param gamma: gamma exponent
+			//@param phi  : scale factor for linear region of transfer function
+			//@param k0   : cutoff for linear region in gamma corrected space (0 for a pure power law)
+			//@param ill  : Luv illuminant as xyz (or NULL to use the rgb white point so that Luv neutrals are rgb neutrals)
+			Profile(const T rgb[3][3], T const * const w, const T a, const T gamma, const T phi, const T k0, T const * const ill = NULL);
+
+			//@brief : predefined profiles (constructed on first use)
+			//@return: profile for the named color space
+			static const Profile& sRGB    ();//sRGB (IEC 61966-2-1), D65
+			static const Profile& adobeRGB();//Adobe RGB (1998), D65, gamma 563/256
+			static const Profile& appleRGB();//Apple RGB, D65, gamma 1.8
+			static const Profile& palRGB  ();//PAL / SECAM RGB, D65, gamma 2.2
+			static const Profile& ntscRGB ();//NTSC / SMPTE C RGB, D65, gamma 2.2
+			static const Profile& cieRGB  ();//CIE (1931) RGB, illuminant E, gamma 2.2
+
+			//@brief    : convert between Luv/XYZ and rgb for this profile (same semantics as the free functions)
+			//@param abc: value to convert from abc color space
+			//@param ijk: location to write value converted to ijk color space (can be the same as parameter abc)
+			//@param gam: evaluation strategy for the transfer function
+			//@return   : true/false if the value falls outside/inside the rgb gamut (and was clamped)
+			bool xyz2rgb(T const * const xyz, T * const rgb, const Gamma gam = Gamma::Exact) const;
+			void rgb2xyz(T const * const rgb, T * const xyz, const Gamma gam = Gamma::Exact) const;
+			bool luv2rgb(T const * const luv, T * const rgb, const Gamma gam = Gamma::Exact) const;
+			void rgb2luv(T const * const rgb, T * const luv, const Gamma gam = Gamma::Exact) const;
+
+			//@brief: batched versions of the above (see batched free functions for parameters)
+			bool luv2rgb(T const * const luv, T * const rgb, const size_t n, const Layout layout, const Gamma gam = Gamma::Exact) const;
+			void rgb2luv(T const * const rgb, T * const luv, const size_t n, const Layout layout, const Gamma gam = Gamma::Exact) const;
+
+			//@brief      : fused Luv -> 8 bit rgb (Luv -> linear rgb -> gamma correction -> clamping -> rounding without any intermediate rgb arrays)
+			//@param luv  : interleaved Luv values to convert
+			//@param rgb  : location to write interleaved 8 bit colors
+			//@param n    : number of colors
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			//@param gam  : evaluation strategy for the transfer function
+			//@return     : true/false if any value fell outside/inside the rgb gamut (and was clamped)
+			bool luv2rgb8(T const * const luv, uint8_t * const rgb, const size_t n, const bool alpha = false, const Gamma gam = Gamma::Exact) const;
+
+			//@brief      : same as above for a block of planar Luv values (for callers that generate Luv colors a block at a time)
+			//@param blk  : block of Luv values to convert (overwritten)
+			//@param rgb  : location to write blk.n interleaved 8 bit colors
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			//@param gam  : evaluation strategy for the transfer function
+			//@return     : true/false if any value fell outside/inside the rgb gamut (and was clamped)
+			bool luv2rgb8(detail::Block<T>& blk, uint8_t * const rgb, const bool alpha, const Gamma gam = Gamma::Exact) const;
+
+			//@brief      : integer only version of the above for a block of planar Q16.16 fixed point Luv values (for cores without fast floating point math)
+			//@param blk  : block of Luv values to convert with 16 fractional bits (e.g. L* = 50 -> 50 << 16)
+			//@param rgb  : location to write blk.n interleaved 8 bit colors
+			//@param alpha: true/false to write rgba (with alpha = 255) / rgb
+			//@return     : true/false if any value fell outside/inside the rgb gamut (and was clamped)
+			//@note       : int32 fused matrix with 64 bit accumulation, one integer division per color, and a linearly interpolated table for the transfer function
+			//              colors are within 1 of the floating point kernel with Gamma::Exact for the same Luv values (the lattice is not used)
+			//              the transfer function table is spaced by octaves of linear value since pure power laws have unbounded slope at black
+			bool luv2rgb8(const detail::Block<int32_t>& blk, uint8_t * const rgb, const bool alpha) const;
+
+			//@brief    : convert from Luv to linear (not gamma corrected or clamped) rgb with the fused matrix
+			//@param luv: Luv value to convert
+			//@param lin: location to write linear rgb (can be the same as luv)
+			void luv2lin(T const * const luv, T * const lin) const;
+
+			//@brief : get the transfer function
+			//@return: transfer function
+			const detail::Transfer<T>& transfer() const {return trc;}
+
+			//@brief  : check if two profiles describe the same rgb color space (e.g. a copy of a predefined profile)
+			//@param o: profile to compare against
+			//@return : true/false if the matrices, illuminant, and transfer function are / aren't identical (a lattice is ignored)
+			bool operator==(const Profile& o) const;
+			bool operator!=(const Profile& o) const {return !(*this == o);}
+
+			//@brief  : get a copy of this profile that converts Luv -> rgb by tetrahedral interpolation of a precomputed lattice instead of exactly
+			//@param n: number of lattice points along each Luv axis, build time and memory grow as n^3 while the error only falls as 1/n^2
+			//          (max Delta E*uv for sRGB is ~14 / 6.3 / 2.8 / 2.0 / 1.2 for n = 17 / 33 / 65 / 97 / 129, check latticeError for other profiles)
+			//@return : profile using the lattice for luv2rgb and luv2rgb8 (the gam argument is ignored for lattice lookups)
+			//@note   : the lattice spans L* [0,100] and the chromaticities of the profile primaries (padded by 15%), coordinates outside are clamped to it
+			//@note   : there is no default size since no lattice of practical size stays below a just noticeable difference everywhere
+			Profile withLattice(const size_t n) const;
+
+			//@brief : get the largest color difference introduced by the lattice (to help choose a lattice size)
+			//@return: estimated max Delta E*uv between lattice and exact in gamut colors (0 if this profile doesn't use a lattice)
+			//@note  : an estimate rather than a bound, measured at the lattice cell centers and on the rgb cube faces (the largest errors are
+			//         just inside the gamut boundary), dense random sampling finds errors up to ~2% larger
+			T latticeError() const;
+
+		private:
+			std::array<T, 9> xyzMat, rgbMat;//xyz -> linear rgb and linear rgb -> xyz
+			std::array<T, 9> luvMat        ;//Luv -> linear rgb * vp / Y with vp = vL * L* + vv * v* (see luv2lin)
+			T                vL, vv        ;//coefficients of vp (4 v' of Luv2XYZ)
+			T                un, vn        ;//normalized illuminant chromaticity for XYZ -> Luv
+			detail::Transfer<T>      trc           ;//transfer function
+			std::shared_ptr<const detail::Lattice<T> > lut;//optional precomputed Luv -> rgb lattice (shared between copies)
+
+			static const int       FixMant = 6    ;//log2 of the number of intervals per octave in the fixed point transfer function table
+			static const int       FixLow  = 6    ;//the table is sampled in octaves of x = Q24 linear value + 2^FixLow (so the first is evenly spaced at exactly 1 Q24 step)
+			static const int       FixOct  = 12   ;//octFix is indexed by x >> FixOct (darker x are shifted up by FixOct first)
+			std::array<int32_t, 9> luvFix         ;//luvMat in Q6.26 (for the fixed point kernel, Q16 coefficients are ~1e-6 off in linear rgb which is a few codes for dark channels of bright colors with gamma 2.2)
+			int32_t                vLFix, vvFix   ;//vL and vv in Q16.16
+			std::vector<uint16_t>  encFix         ;//encoded 8 bit values in 8.8 fixed point for 2^FixMant evenly spaced values of x per octave in [2^FixLow, 2^24] (+ 1 padding entry)
+			std::vector<uint8_t >  octFix         ;//left shift normalizing x into [2^24, 2^25) indexed by x >> FixOct
+
+			//@brief    : block version of luv2lin
+			//@param blk: block of Luv values to convert to linear rgb in place
+			void linBlock(detail::Block<T>& blk) const;
+	};
+
 	namespace detail {
 		//@brief    : invert a 3x3 matrix analytically
 		//@param mat: matrix to invert in row major order
-		template <typename T> std::array<T, 9> inv3x3(const std::array<T, 9>& mat) {
+		template <typename T> constexpr std::array<T, 9> inv3x3(const std::array<T, 9>& mat) {
 			const T det = mat[3*0+0] * mat[3*1+1] * mat[3*2+2] + mat[3*0+1] * mat[3*1+2] * mat[3*2+0] + mat[3*0+2] * mat[3*1+0] * mat[3*2+1]
 						-(mat[3*0+0] * mat[3*1+2] * mat[3*2+1] + mat[3*0+1] * mat[3*1+0] * mat[3*2+2] + mat[3*0+2] * mat[3*1+1] * mat[3*2+0]);
 			return std::array<T, 9> {
@@ -114,7 +327,7 @@ namespace color {
 		//@param rgb: chromaticity of {red point, green point, blue point} as XYZ
 		//@param w  : chromaticity of white point as XYZ
 		template <typename T>
-		std::array<T, 9> rgbMat(const T rgb[3][3], T const w[3]) {
+		constexpr std::array<T, 9> rgbMat(const T rgb[3][3], T const w[3]) {
 			//build and invert 3x3 matrices to solve for rows of conversion matrix
 			//matrix * (r, g, b) = {x, 0, 0}, {0, x, 0}, {0, x, 0} and matrix^-1 * {1,1,1} = w
 			const T W[3] = {w[0] / w[1], T(1), w[2] / w[1]};
@@ -177,51 +390,287 @@ namespace color {
 		};
 
 		//standard illuminants as xyz (normalized XYZ)
-		template <typename T> const T Standards<T>::A_2   [3] = {T(0.44757), T(0.40745), T(0.14498)};
-		template <typename T> const T Standards<T>::A_10  [3] = {T(0.45117), T(0.40594), T(0.14289)};
-		template <typename T> const T Standards<T>::B_2   [3] = {T(0.34842), T(0.35161), T(0.29997)};
-		template <typename T> const T Standards<T>::B_10  [3] = {T(0.34980), T(0.35270), T(0.29750)};
-		template <typename T> const T Standards<T>::C_2   [3] = {T(0.31006), T(0.31616), T(0.37378)};
-		template <typename T> const T Standards<T>::C_10  [3] = {T(0.31039), T(0.31905), T(0.37056)};
-		template <typename T> const T Standards<T>::D50_2 [3] = {T(0.34567), T(0.35850), T(0.29583)};
-		template <typename T> const T Standards<T>::D50_10[3] = {T(0.34773), T(0.35952), T(0.29275)};
-		template <typename T> const T Standards<T>::D55_2 [3] = {T(0.33242), T(0.34743), T(0.32015)};
-		template <typename T> const T Standards<T>::D55_10[3] = {T(0.33411), T(0.34877), T(0.31712)};
-		template <typename T> const T Standards<T>::D65_2 [3] = {T(0.31271), T(0.32902), T(0.35827)};
-		template <typename T> const T Standards<T>::D65_10[3] = {T(0.31382), T(0.33100), T(0.35518)};
-		template <typename T> const T Standards<T>::D75_2 [3] = {T(0.29902), T(0.31485), T(0.38613)};
-		template <typename T> const T Standards<T>::D75_10[3] = {T(0.29968), T(0.31740), T(0.38292)};
-		template <typename T> const T Standards<T>::E     [3] = {T(1)/T(3) , T(1)/T(3) , T(1)/T(3) };
+		template <typename T> constexpr T Standards<T>::A_2   [3] = {T(0.44757), T(0.40745), T(0.14498)};
+		template <typename T> constexpr T Standards<T>::A_10  [3] = {T(0.45117), T(0.40594), T(0.14289)};
+		template <typename T> constexpr T Standards<T>::B_2   [3] = {T(0.34842), T(0.35161), T(0.29997)};
+		template <typename T> constexpr T Standards<T>::B_10  [3] = {T(0.34980), T(0.35270), T(0.29750)};
+		template <typename T> constexpr T Standards<T>::C_2   [3] = {T(0.31006), T(0.31616), T(0.37378)};
+		template <typename T> constexpr T Standards<T>::C_10  [3] = {T(0.31039), T(0.31905), T(0.37056)};
+		template <typename T> constexpr T Standards<T>::D50_2 [3] = {T(0.34567), T(0.35850), T(0.29583)};
+		template <typename T> constexpr T Standards<T>::D50_10[3] = {T(0.34773), T(0.35952), T(0.29275)};
+		template <typename T> constexpr T Standards<T>::D55_2 [3] = {T(0.33242), T(0.34743), T(0.32015)};
+		template <typename T> constexpr T Standards<T>::D55_10[3] = {T(0.33411), T(0.34877), T(0.31712)};
+		template <typename T> constexpr T Standards<T>::D65_2 [3] = {T(0.31271), T(0.32902), T(0.35827)};
+		template <typename T> constexpr T Standards<T>::D65_10[3] = {T(0.31382), T(0.33100), T(0.35518)};
+		template <typename T> constexpr T Standards<T>::D75_2 [3] = {T(0.29902), T(0.31485), T(0.38613)};
+		template <typename T> constexpr T Standards<T>::D75_10[3] = {T(0.29968), T(0.31740), T(0.38292)};
+		template <typename T> constexpr T Standards<T>::E     [3] = {T(1)/T(3) , T(1)/T(3) , T(1)/T(3) };
 
 		//RGB chromaticities as xyz (normalized XYZ)
-		template <typename T> const T Standards<T>::sRGB    [3][3] = {T(0.6400), T(0.3300), T(0.0300),
+		template <typename T> constexpr T Standards<T>::sRGB    [3][3] = {T(0.6400), T(0.3300), T(0.0300),
 																	  T(0.3000), T(0.6000), T(0.1000),
 																	  T(0.1500), T(0.0600), T(0.7900)};
-		template <typename T> const T Standards<T>::cieRGB  [3][3] = {T(0.7347), T(0.2653), T(0.0000),
+		template <typename T> constexpr T Standards<T>::cieRGB  [3][3] = {T(0.7347), T(0.2653), T(0.0000),
 																	  T(0.2738), T(0.7174), T(0.0088),
 																	  T(0.1666), T(0.0089), T(0.8245)};
-		template <typename T> const T Standards<T>::appleRGB[3][3] = {T(0.6250), T(0.3400), T(0.0350),
+		template <typename T> constexpr T Standards<T>::appleRGB[3][3] = {T(0.6250), T(0.3400), T(0.0350),
 																	  T(0.2800), T(0.5950), T(0.1250),
 																	  T(0.1550), T(0.0700), T(0.7750)};
-		template <typename T> const T Standards<T>::adobeRGB[3][3] = {T(0.6400), T(0.3300), T(0.0300),
+		template <typename T> constexpr T Standards<T>::adobeRGB[3][3] = {T(0.6400), T(0.3300), T(0.0300),
 																	  T(0.2100), T(0.7100), T(0.0800),
 																	  T(0.1500), T(0.0600), T(0.7900)};
-		template <typename T> const T Standards<T>::palRGB  [3][3] = {T(0.6400), T(0.3300), T(0.0300),
+		template <typename T> constexpr T Standards<T>::palRGB  [3][3] = {T(0.6400), T(0.3300), T(0.0300),
 																	  T(0.2900), T(0.6000), T(0.1100),
 																	  T(0.1500), T(0.0600), T(0.7900)};
-		template <typename T> const T Standards<T>::ntscRGB [3][3] = {T(0.6300), T(0.3400), T(0.0300),
+		template <typename T> constexpr T Standards<T>::ntscRGB [3][3] = {T(0.6300), T(0.3400), T(0.0300),
 																	  T(0.3100), T(0.5950), T(0.0950),
 																	  T(0.1550), T(0.0700), T(0.7750)};
 
 		//sRGB gamma correction constants
-		template <typename T> const T Standards<T>::sA     = T(0.055  );
-		template <typename T> const T Standards<T>::sGamma = T(2.4    );
-		template <typename T> const T Standards<T>::sPhi   = T(12.92  );
-		template <typename T> const T Standards<T>::sK0    = T(0.04045);
-
-		//sRGB conversion matrices
-		template <typename T> const std::array<T, 9> Standards<T>::sRGBmat    = detail::rgbMat(Standards<T>::sRGB, Standards<T>::D65_2);
-		template <typename T> const std::array<T, 9> Standards<T>::sRGBmatInv = detail::inv3x3(Standards<T>::sRGBmat);
+		template <typename T> constexpr T Standards<T>::sA     = T(0.055  );
+		template <typename T> constexpr T Standards<T>::sGamma = T(2.4    );
+		template <typename T> constexpr T Standards<T>::sPhi   = T(12.92  );
+		template <typename T> constexpr T Standards<T>::sK0    = T(0.04045);
+
+		//sRGB conversion matrices (evaluated at compile time)
+		template <typename T> constexpr std::array<T, 9> Standards<T>::sRGBmat    = detail::rgbMat(Standards<T>::sRGB, Standards<T>::D65_2);
+		template <typename T> constexpr std::array<T, 9> Standards<T>::sRGBmatInv = detail::inv3x3(Standards<T>::sRGBmat);
+
+		//unsigned integer types the same size as floating point types (for bit manipulation)
+		template <typename T> struct FloatBits;
+		template <> struct FloatBits<float > {typedef uint32_t U; typedef int32_t I; static const int Mant = 23;};
+		template <> struct FloatBits<double> {typedef uint64_t U; typedef int64_t I; static const int Mant = 52;};
+
+		//@brief  : fast approximation of log2(x) (minimax polynomial in z = (m-1)/(m+1) for x = m * 2^e with m in [sqrt(1/2), sqrt(2)))
+		//@param x: finite positive value to compute log2 of
+		//@return : log2(x) (absolute error < 3e-12 + rounding error of T)
+		//@note   : branch free (vectorizable) but requires IEEE arithmetic (don't compile with -ffast-math)
+		template <typename T> T fastLog2(const T x) {
+			typedef typename FloatBits<T>::U U;
+			typedef typename FloatBits<T>::I I;
+			const T sqrtHalf = T(0.70710678118654752440);
+			U ix, ih;
+			std::memcpy(&ix, &x       , sizeof(T));
+			std::memcpy(&ih, &sqrtHalf, sizeof(T));
+			const I e = static_cast<I>(ix - ih) >> FloatBits<T>::Mant;//exponent such that x / 2^e falls in [sqrt(1/2), sqrt(2))
+			const U im = ix - (static_cast<U>(e) << FloatBits<T>::Mant);//remove exponent
+			T m;
+			std::memcpy(&m, &im, sizeof(T));
+			const T z  = (m - 1) / (m + 1);
+			const T zz = z * z;
+			return T(e) + z * (T(2.885390081786939) + zz * (T(0.9617966747466538) + zz * (T(0.5770834150706242) + zz * (T(0.4116803558321321) + zz * T(0.3406153819375357)))));
+		}
+
+		//@brief  : fast approximation of 2^y (minimax polynomial on [-1/2, 1/2] scaled by an integer power of 2)
+		//@param y: value to compute 2^y of (clamped to the range of normal numbers)
+		//@return : 2^y (relative error < 5e-11 + rounding error of T)
+		//@note   : branch free (vectorizable) but requires IEEE arithmetic (don't compile with -ffast-math)
+		template <typename T> T fastExp2(const T y) {
+			typedef typename FloatBits<T>::U U;
+			const T lim   = T(std::numeric_limits<T>::max_exponent - 2);
+			const T magic = T(3) * T(U(1) << (FloatBits<T>::Mant - 1));//adding 1.5 * 2^mantissa bits rounds to an integer stored in the low bits
+			const T yc = std::min(std::max(y, -lim), lim);
+			const T kr = yc + magic;
+			const T f  = yc - (kr - magic);//fractional part [-1/2, 1/2]
+			const T p = T(0.999999999959549) + f * (T(0.6931471805350404) + f * (T(0.2402265121358422) + f * (T(0.05550410976064549) + f * (T(0.009618025604129209) + f * (T(0.0013333422681628183) + f * (T(0.00015469731661948885) + f * T(1.5316453320323198e-05)))))));
+			U ik, ip;
+			std::memcpy(&ik, &kr, sizeof(T));
+			std::memcpy(&ip, &p , sizeof(T));
+			ip += ik << FloatBits<T>::Mant;//multiply by 2^k (low bits of ik hold k in two's complement)
+			T v;
+			std::memcpy(&v, &ip, sizeof(T));
+			return v;
+		}
+
+		//@brief  : choose between two values without branching
+		//@param c: condition
+		//@param a: value for true
+		//@param b: value for false
+		//@return : c ? a : b
+		//@note   : the float specialization blends the bits of both values so loops containing it vectorize without masked instructions (SSE2/AVX2),
+		//          double loops need 64 bit arithmetic shifts to vectorize (AVX-512, which has masking anyway) so the plain select is faster as scalar code
+		template <typename T> T blend(const bool c, const T a, const T b) {return c ? a : b;}
+		template <> inline float blend<float>(const bool c, const float a, const float b) {
+			uint32_t ia, ib;
+			std::memcpy(&ia, &a, sizeof(float));
+			std::memcpy(&ib, &b, sizeof(float));
+			const uint32_t m = uint32_t(0) - uint32_t(c);//all ones / zeros
+			const uint32_t ir = (ia & m) | (ib & ~m);
+			float r;
+			std::memcpy(&r, &ir, sizeof(float));
+			return r;
+		}
+
+		//@brief: float versions of fastLog2 and fastExp2 with lower degree polynomials (fit to float precision) and branch free clamping so they vectorize on SSE2
+		//        fastLog2<float> absolute error < 3e-8, fastExp2<float> relative error < 8e-8 (+ rounding error of float)
+		template <> inline float fastLog2<float>(const float x) {
+			const float sqrtHalf = 0.70710678118654752440f;
+			uint32_t ix, ih;
+			std::memcpy(&ix, &x       , sizeof(float));
+			std::memcpy(&ih, &sqrtHalf, sizeof(float));
+			const int32_t e = static_cast<int32_t>(ix - ih) >> 23;//exponent such that x / 2^e falls in [sqrt(1/2), sqrt(2))
+			const uint32_t im = ix - (static_cast<uint32_t>(e) << 23);//remove exponent
+			float m;
+			std::memcpy(&m, &im, sizeof(float));
+			const float z  = (m - 1) / (m + 1);
+			const float zz = z * z;
+			return float(e) + z * (2.885391289388242f + zz * (0.9614708049733098f + zz * 0.5989740306597763f));
+		}
+
+		template <> inline float fastExp2<float>(const float y) {
+			const float lim   = float(std::numeric_limits<float>::max_exponent - 2);
+			const float magic = 12582912.0f;//1.5 * 2^23
+			const float yc = blend(y < -lim, -lim, blend(y > lim, lim, y));//std::min/max are branches to the vectorizer
+			const float kr = yc + magic;
+			const float f  = yc - (kr - magic);//fractional part [-1/2, 1/2]
+			const float p = 1.0000000716554973f + f * (0.6931469670212131f + f * (0.2402211971762996f + f * (0.055507133397239054f + f * (0.009675541728640337f + f * 0.0013276452133893064f))));
+			uint32_t ik, ip;
+			std::memcpy(&ik, &kr, sizeof(float));
+			std::memcpy(&ip, &p , sizeof(float));
+			ip += ik << 23;//multiply by 2^k (low bits of ik hold k in two's complement)
+			float v;
+			std::memcpy(&v, &ip, sizeof(float));
+			return v;
+		}
+
+		//@brief  : fast approximation of cbrt(x) (bit manipulation initial guess refined with Halley iterations)
+		//@param x: finite positive value to compute cube root of (other values return garbage without trapping)
+		//@return : cbrt(x) (relative error < 4e-7 for float, < 2e-15 for double)
+		//@note   : branch free (vectorizable) but requires IEEE arithmetic (don't compile with -ffast-math)
+		template <typename T> T fastCbrt(const T x) {
+			typedef typename FloatBits<T>::U U;
+			const T one = T(1);
+			U ix, io;
+			std::memcpy(&ix, &x  , sizeof(T));
+			std::memcpy(&io, &one, sizeof(T));
+			U iy = ix / 3 + io / 3 * 2;//dividing the exponent (and mantissa) by 3 gives a guess within 6%
+			T y;
+			std::memcpy(&y, &iy, sizeof(T));
+			for(size_t i = 0; i < (sizeof(T) > 4 ? 3 : 2); i++) {//each Halley step cubes the relative error
+				const T y3 = y * y * y;
+				y *= (y3 + x * 2) / (y3 * 2 + x);
+			}
+			return y;
+		}
+
+		//@brief: rgb transfer function (gamma curve with an optional linear segment near black)
+		//        encode(x) = x <= k0 / phi ? x * phi : (1 + a) * x^(1/gamma) - a [linear -> gamma corrected]
+		//        decode(y) = y <= k0       ? y / phi : ((y + a) / (1 + a))^gamma [gamma corrected -> linear]
+		//@note: Gamma::Fast  evaluates powers as fastExp2(p * fastLog2(x)), max error over [0,1] is 5e-11 (double) / 3e-7 (float)
+		//       or < 1e-4 8 bit units and < 0.02 16 bit units for either type
+		//@note: Gamma::Table linearly interpolates TableSize+1 samples (uniform in sqrt(x) for encoding and in y for decoding),
+		//       max error over [0,1] is 4e-8 (double) / 3e-7 (float) or < 1e-4 8 bit units and < 0.02 16 bit units for either type
+		template <typename T>
+		struct Transfer {
+			public:
+				static const size_t TableSize = 4096;//number of intervals in lookup tables
+
+				//@brief      : construct a transfer function
+				//@param a    : deviation of gamma correction coefficient from 1
+				//@param gamma: gamma exponent
+				//@param phi  : scale factor for linear region
+				//@param k0   : cutoff for linear region in gamma corrected space
+				Transfer(const T a, const T gamma, const T phi, const T k0);
+
+				//@brief     : gamma correct linear values in place
+				//@param v   : values to correct
+				//@param n   : number of values
+				//@param mode: evaluation strategy
+				void encode(T * const v, const size_t n, const Gamma mode) const;
+
+				//@brief     : linearize gamma corrected values in place
+				//@param v   : values to linearize
+				//@param n   : number of values
+				//@param mode: evaluation strategy
+				void decode(T * const v, const size_t n, const Gamma mode) const;
+
+				//@brief     : single value versions of encode/decode
+				//@param v   : value to correct/linearize
+				//@param mode: evaluation strategy
+				//@return    : corrected/linearized value
+				T encode(const T v, const Gamma mode) const {T x = v; encode(&x, 1, mode); return x;}
+				T decode(const T v, const Gamma mode) const {T x = v; decode(&x, 1, mode); return x;}
+
+				//@brief  : check if two transfer functions are the same curve
+				//@param o: transfer function to compare against
+				//@return : true/false if the curve parameters are / aren't identical (everything else is derived from them)
+				bool operator==(const Transfer& o) const {return a == o.a && g == o.g && phi == o.phi && k0 == o.k0;}
+
+			private:
+				//@brief    : linearly interpolate (or extrapolate past the end of) a lookup table
+				//@param lut: table to interpolate with TableSize + 1 samples over [0,1]
+				//@param t  : fractional position in table (>= 0)
+				//@return   : interpolated value
+				static T lerp(const std::vector<T>& lut, const T t) {
+					const T s = t * T(TableSize);
+					const size_t i = (size_t) std::min<int>((int)std::min(T(TableSize), s), (int)TableSize - 1);//NAN -> last interval
+					return lut[i] + (lut[i+1] - lut[i]) * (s - T(i));
+				}
+
+				T a, a1, g, gInv, phi, k0, k0Inv;//curve parameters (and derived constants)
+				std::vector<T> encLut, decLut;//lookup tables for encoding (sampled uniformly in sqrt(x)) and decoding
+		};
+
+		//@brief: get the transfer function for sRGB
+		//@return: sRGB transfer function (constructed on first use)
+		template <typename T> const Transfer<T>& sRGBTransfer() {
+			static const Transfer<T> trc(Standards<T>::sA, Standards<T>::sGamma, Standards<T>::sPhi, Standards<T>::sK0);
+			return trc;
+		}
+
+		//@brief      : construct a transfer function
+		//@param a    : deviation of gamma correction coefficient from 1
+		//@param gamma: gamma exponent
+		//@param phi  : scale factor for linear region
+		//@param k0   : cutoff for linear region in gamma corrected space
+		template <typename T>
+		Transfer<T>::Transfer(const T a, const T gamma, const T phi, const T k0) : a(a), a1(T(1) + a), g(gamma), gInv(T(1) / gamma), phi(phi), k0(k0), k0Inv(k0 / phi), encLut(TableSize + 1), decLut(TableSize + 1) {
+			for(size_t i = 0; i <= TableSize; i++) {
+				const T x = T(i) / T(TableSize);
+				encLut[i] = a1 * std::pow(x, gInv * 2) - a;//samples at x^2
+				decLut[i] = std::pow((x + a) / a1, g);
+			}
+		}
+
+		//@brief     : gamma correct linear values in place
+		//@param v   : values to correct
+		//@param n   : number of values
+		//@param mode: evaluation strategy
+		template <typename T>
+		void Transfer<T>::encode(T * const v, const size_t n, const Gamma mode) const {
+			switch(mode) {
+				case Gamma::Exact: for(size_t i = 0; i < n; i++) v[i] = v[i] <= k0Inv ? v[i] * phi : a1 * std::pow(v[i], gInv) - a                      ; break;
+				case Gamma::Fast : {//copy parameters to locals and evaluate both branches so the loop is vectorizable
+					const T cut = k0Inv, p = phi, s = a1, o = a, e = gInv;
+					for(size_t i = 0; i < n; i++) {
+						const T lin = v[i] * p;
+						const T pw  = s * fastExp2(e * fastLog2(v[i])) - o;
+						v[i] = blend(v[i] <= cut, lin, pw);
+					}
+				} break;
+				case Gamma::Table: for(size_t i = 0; i < n; i++) v[i] = v[i] <= k0Inv ? v[i] * phi : lerp(encLut, std::sqrt(std::max(v[i], T(0))))    ; break;
+			}
+		}
+
+		//@brief     : linearize gamma corrected values in place
+		//@param v   : values to linearize
+		//@param n   : number of values
+		//@param mode: evaluation strategy
+		template <typename T>
+		void Transfer<T>::decode(T * const v, const size_t n, const Gamma mode) const {
+			switch(mode) {
+				case Gamma::Exact: for(size_t i = 0; i < n; i++) v[i] = v[i] <= k0 ? v[i] / phi : std::pow((v[i] + a) / a1, g)              ; break;
+				case Gamma::Fast : {//copy parameters to locals and evaluate both branches so the loop is vectorizable
+					const T cut = k0, p = T(1) / phi, o = a, s = T(1) / a1, e = g;
+					for(size_t i = 0; i < n; i++) {
+						const T lin = v[i] * p;
+						const T pw  = fastExp2(e * fastLog2((v[i] + o) * s));
+						v[i] = blend(v[i] <= cut, lin, pw);
+					}
+				} break;
+				case Gamma::Table: for(size_t i = 0; i < n; i++) v[i] = v[i] <= k0 ? v[i] / phi : lerp(decLut, std::max(v[i], T(0)))        ; break;
+			}
+		}
 	}
 
 	////////////////////////////////////////////
@@ -231,15 +680,21 @@ namespace color {
 	//@brief    : convert from XYZ to sRGB
 	//@param xyz: XYZ (X, Y, Z) values to convert
 	//@param rgb: location to write sRGB (red, green, blue) values
+	//@param gam: evaluation strategy for the sRGB transfer function
 	//@return   : true/false if xyz falls outside/inside the sRGB color gamut
-	template <typename T> bool xyz2rgb(T const * const xyz, T * const rgb) {
+	template <typename T> bool xyz2rgb(T const * const xyz, T * const rgb, const Gamma gam) {
 		using namespace detail;
 		static const T gammaInv = T(1) / Standards<T>::sGamma;
 		static const T k0Inv    = Standards<T>::sK0 / Standards<T>::sPhi;
 		static const T a1       = T(1) + Standards<T>::sA;
 		T work[3];
 		for(size_t i = 0; i < 3; i++) work[i] = std::inner_product(xyz, xyz+3, Standards<T>::sRGBmat.begin() + 3*i, T(0));//XYZ -> linear rgb
-		for(size_t i = 0; i < 3; i++) rgb[i] = work[i] <= k0Inv ? work[i] * Standards<T>::sPhi : a1 * std::pow(work[i], gammaInv) - Standards<T>::sA;//gamma correction
+		if(Gamma::Exact == gam) {
+			for(size_t i = 0; i < 3; i++) rgb[i] = work[i] <= k0Inv ? work[i] * Standards<T>::sPhi : a1 * std::pow(work[i], gammaInv) - Standards<T>::sA;//gamma correction
+		} else {
+			sRGBTransfer<T>().encode(work, 3, gam);//approximate gamma correction
+			std::copy(work, work+3, rgb);
+		}
 
 		//check if this value is outside the sRGB color gamut
 		bool clamped = false;
@@ -258,11 +713,17 @@ namespace color {
 	//@brief    : convert from sRGB to XYZ
 	//@param rgb: sRGB (red, green, blue) values to convert
 	//@param xyz: location to write XYZ (X, Y, Z) values
-	template <typename T> void rgb2xyz(T const * const rgb, T * const xyz) {
+	//@param gam: evaluation strategy for the sRGB transfer function
+	template <typename T> void rgb2xyz(T const * const rgb, T * const xyz, const Gamma gam) {
 		using namespace detail;
 		static const T a1 = T(1) + Standards<T>::sA;
 		T work[3];
-		for(size_t i = 0; i < 3; i++) xyz[i] = rgb[i] <= Standards<T>::sK0 ? rgb[i] / Standards<T>::sPhi : std::pow((rgb[i]+Standards<T>::sA) / a1, Standards<T>::sGamma);//gamma correction
+		if(Gamma::Exact == gam) {
+			for(size_t i = 0; i < 3; i++) xyz[i] = rgb[i] <= Standards<T>::sK0 ? rgb[i] / Standards<T>::sPhi : std::pow((rgb[i]+Standards<T>::sA) / a1, Standards<T>::sGamma);//gamma correction
+		} else {
+			std::copy(rgb, rgb+3, xyz);
+			sRGBTransfer<T>().decode(xyz, 3, gam);//approximate gamma correction
+		}
 		for(size_t i = 0; i < 3; i++) work[i] = std::inner_product(xyz, xyz+3, Standards<T>::sRGBmatInv.begin() + 3*i, T(0));//XYZ -> linear rgb
 		std::copy(work, work+3, xyz);
 	}
@@ -458,10 +919,10 @@ namespace color {
 	template <typename T> bool xyz2hsl(T const * const xyz, T * const hsl               ) {const bool b = xyz2rgb(xyz, hsl); rgb2hsl(hsl, hsl); return b;}//xyz->rgb->hsl
 
 	//illuminated cie spaces -> rgb/hsv/hsl (using cie spaces -> xyz -> rgb)
-	template <typename T> bool luv2rgb(T const * const luv, T * const rgb, T const * ill) {luv2xyz(luv, rgb, ill); return xyz2rgb(rgb, rgb);}//luv->xyz->rgb
+	template <typename T> bool luv2rgb(T const * const luv, T * const rgb, T const * ill, const Gamma gam) {luv2xyz(luv, rgb, ill); return xyz2rgb(rgb, rgb, gam);}//luv->xyz->rgb
 	template <typename T> bool luv2hsv(T const * const luv, T * const hsv, T const * ill) {luv2xyz(luv, hsv, ill); return xyz2hsv(hsv, hsv);}//luv->xyz->rgb->hsv
 	template <typename T> bool luv2hsl(T const * const luv, T * const hsl, T const * ill) {luv2xyz(luv, hsl, ill); return xyz2hsl(hsl, hsl);}//luv->xyz->rgb->hsl
-	template <typename T> bool lab2rgb(T const * const lab, T * const rgb, T const * ill) {lab2xyz(lab, rgb, ill); return xyz2rgb(rgb, rgb);}//lab->xyz->rgb
+	template <typename T> bool lab2rgb(T const * const lab, T * const rgb, T const * ill, const Gamma gam) {lab2xyz(lab, rgb, ill); return xyz2rgb(rgb, rgb, gam);}//lab->xyz->rgb
 	template <typename T> bool lab2hsv(T const * const lab, T * const hsv, T const * ill) {lab2xyz(lab, hsv, ill); return xyz2hsv(hsv, hsv);}//lab->xyz->rgb->hsv
 	template <typename T> bool lab2hsl(T const * const lab, T * const hsl, T const * ill) {lab2xyz(lab, hsl, ill); return xyz2hsl(hsl, hsl);}//lab->xyz->rgb->hsl
 
@@ -470,14 +931,864 @@ namespace color {
 	template <typename T> void lab2luv(T const * const lab, T * const luv, T const * ill) {lab2xyz(lab, luv, ill); xyz2luv(luv, luv, ill);}//lab->xyz->luv
 
 	//rgb/hsv/hsl to cie spaces (all go through rgb -> xyz)
-	template <typename T> void rgb2luv(T const * const rgb, T * const luv, T const * ill) {                   rgb2xyz(rgb, luv); xyz2luv(luv, luv, ill);}//     rgb->xyz->luv
-	template <typename T> void rgb2lab(T const * const rgb, T * const lab, T const * ill) {                   rgb2xyz(rgb, lab); xyz2lab(lab, lab, ill);}//     rgb->xyz->lab
+	template <typename T> void rgb2luv(T const * const rgb, T * const luv, T const * ill, const Gamma gam) {rgb2xyz(rgb, luv, gam); xyz2luv(luv, luv, ill);}//     rgb->xyz->luv
+	template <typename T> void rgb2lab(T const * const rgb, T * const lab, T const * ill, const Gamma gam) {rgb2xyz(rgb, lab, gam); xyz2lab(lab, lab, ill);}//     rgb->xyz->lab
 	template <typename T> void hsv2xyz(T const * const hsv, T * const xyz               ) {hsv2rgb(hsv, xyz); rgb2xyz(xyz, xyz);                        }//hsv->rgb->xyz
 	template <typename T> void hsv2luv(T const * const hsv, T * const luv, T const * ill) {hsv2rgb(hsv, luv); rgb2xyz(luv, luv); xyz2luv(luv, luv, ill);}//hsv->rgb->xyz->luv
 	template <typename T> void hsv2lab(T const * const hsv, T * const lab, T const * ill) {hsv2rgb(hsv, lab); rgb2xyz(lab, lab); xyz2lab(lab, lab, ill);}//hsv->rgb->xyz->lab
 	template <typename T> void hsl2xyz(T const * const hsl, T * const xyz               ) {hsl2rgb(hsl, xyz); rgb2xyz(xyz, xyz);                        }//hsl->rgb->xyz
 	template <typename T> void hsl2luv(T const * const hsl, T * const luv, T const * ill) {hsl2rgb(hsl, luv); rgb2xyz(luv, luv); xyz2luv(luv, luv, ill);}//hsl->rgb->xyz->luv
 	template <typename T> void hsl2lab(T const * const hsl, T * const lab, T const * ill) {hsl2rgb(hsl, lab); rgb2xyz(lab, lab); xyz2lab(lab, lab, ill);}//hsl->rgb->xyz->lab
+
+	////////////////////////////////////////////
+	//       batched conversion kernels       //
+	////////////////////////////////////////////
+
+	namespace detail {
+		//number of colors converted at once by batched conversions (3 channels of 128 doubles fit comfortably in L1)
+		static const size_t BatchSize = 128;
+
+		//planar working storage for a block of colors
+		template <typename T> struct Block {
+			T c[3][BatchSize];//channel planes
+			size_t n;//number of valid colors in each plane
+		};
+
+		//@brief       : copy colors from an array into a block
+		//@param src   : array of colors to copy from
+		//@param count : total number of colors in src (distance between channels for planar data)
+		//@param i     : index of first color to copy
+		//@param layout: memory layout of src
+		//@param blk   : block to copy into (blk.n colors are copied)
+		template <typename T> void loadBlock(T const * const src, const size_t count, const size_t i, const Layout layout, Block<T>& blk) {
+			if(Layout::Planar == layout) {
+				for(size_t k = 0; k < 3; k++) std::copy(src + k * count + i, src + k * count + i + blk.n, blk.c[k]);
+			} else {
+				T const * const p = src + 3 * i;
+				for(size_t j = 0; j < blk.n; j++) {
+					blk.c[0][j] = p[3*j+0];
+					blk.c[1][j] = p[3*j+1];
+					blk.c[2][j] = p[3*j+2];
+				}
+			}
+		}
+
+		//@brief       : copy colors from a block into an array
+		//@param blk   : block to copy from (blk.n colors are copied)
+		//@param dst   : array of colors to copy to
+		//@param count : total number of colors in dst (distance between channels for planar data)
+		//@param i     : index of first color to write
+		//@param layout: memory layout of dst
+		template <typename T> void storeBlock(const Block<T>& blk, T * const dst, const size_t count, const size_t i, const Layout layout) {
+			if(Layout::Planar == layout) {
+				for(size_t k = 0; k < 3; k++) std::copy(blk.c[k], blk.c[k] + blk.n, dst + k * count + i);
+			} else {
+				T * const p = dst + 3 * i;
+				for(size_t j = 0; j < blk.n; j++) {
+					p[3*j+0] = blk.c[0][j];
+					p[3*j+1] = blk.c[1][j];
+					p[3*j+2] = blk.c[2][j];
+				}
+			}
+		}
+
+		//@brief       : convert an array of colors block by block
+		//@param in    : colors to convert
+		//@param out   : location to write converted colors (can be the same as in)
+		//@param n     : number of colors
+		//@param layout: memory layout of in and out
+		//@param kernel: function to convert a block in place, bool(Block<T>&) returning true if any colors were clamped
+		//@return      : true if any call to kernel returned true
+		template <typename T, typename Kernel> bool batch(T const * const in, T * const out, const size_t n, const Layout layout, Kernel kernel) {
+			Block<T> blk;
+			bool clamped = false;
+			for(size_t i = 0; i < n; i += BatchSize) {
+				blk.n = std::min(BatchSize, n - i);
+				loadBlock(in, n, i, layout, blk);
+				if(kernel(blk)) clamped = true;
+				storeBlock(blk, out, n, i, layout);
+			}
+			return clamped;
+		}
+
+		//@brief     : apply a scalar conversion to each color in a block (for conversions with data dependent branches)
+		//@param blk : block of colors to convert in place
+		//@param func: scalar conversion function
+		template <typename T> void pixelBlock(Block<T>& blk, void(*func)(T const * const, T * const)) {
+			for(size_t j = 0; j < blk.n; j++) {
+				T work[3] = {blk.c[0][j], blk.c[1][j], blk.c[2][j]};
+				func(work, work);
+				for(size_t k = 0; k < 3; k++) blk.c[k][j] = work[k];
+			}
+		}
+
+		//@brief    : apply a 3x3 matrix to each color in a block
+		//@param blk: block of colors to transform in place
+		//@param mat: matrix in row major order
+		template <typename T> void matBlock(Block<T>& blk, const std::array<T, 9>& mat) {
+			T * const c0 = blk.c[0];
+			T * const c1 = blk.c[1];
+			T * const c2 = blk.c[2];
+			for(size_t j = 0; j < blk.n; j++) {
+				const T x = c0[j], y = c1[j], z = c2[j];
+				c0[j] = x * mat[0] + y * mat[1] + z * mat[2];
+				c1[j] = x * mat[3] + y * mat[4] + z * mat[5];
+				c2[j] = x * mat[6] + y * mat[7] + z * mat[8];
+			}
+		}
+
+		//@brief    : clamp each color in a block to [0,1]
+		//@param blk: block of colors to clamp in place
+		//@return   : true/false if any color was clamped
+		template <typename T> bool clampBlock(Block<T>& blk) {
+			bool clamped = false;
+			for(size_t k = 0; k < 3; k++) {
+				T * const c = blk.c[k];
+				for(size_t j = 0; j < blk.n; j++) {
+					const T v  = c[j];
+					const bool lo = std::signbit(v);
+					const bool hi = v > T(1);
+					c[j] = lo ? T(0) : (hi ? T(1) : v);//clamp to gamut
+					clamped |= lo || hi;
+				}
+			}
+			return clamped;
+		}
+
+		//@brief      : clamp each color in a block to [0,1] and round to 8 bits
+		//@param blk  : block of colors to quantize
+		//@param rgb  : location to write blk.n interleaved 8 bit colors
+		//@param alpha: true/false to write 4/3 bytes per color (alpha = 255)
+		//@return     : true/false if any color was clamped
+		template <typename T> bool quantizeBlock(const Block<T>& blk, uint8_t * const rgb, const bool alpha) {
+			const size_t stride = alpha ? 4 : 3;
+			bool clamped = false;
+			for(size_t k = 0; k < 3; k++) {
+				T const * const c = blk.c[k];
+				uint8_t * const p = rgb + k;
+				for(size_t j = 0; j < blk.n; j++) {
+					const T v  = c[j];
+					const bool lo = std::signbit(v);
+					const bool hi = v > T(1);
+					const T vc = lo ? T(0) : (hi ? T(1) : v);//clamp to gamut
+					p[stride*j] = (uint8_t)(int32_t)(vc * 255 + T(0.5));//value is non-negative so truncation rounds to nearest
+					clamped |= lo || hi;
+				}
+			}
+			if(alpha) for(size_t j = 0; j < blk.n; j++) rgb[4*j+3] = 0xFF;
+			return clamped;
+		}
+
+		//@brief    : block version of xyz2rgb
+		//@param blk: block of colors to convert in place
+		//@param gam: evaluation strategy for the sRGB transfer function
+		//@return   : true/false if any color was clamped to the sRGB gamut
+		template <typename T> bool xyz2rgbBlock(Block<T>& blk, const Gamma gam) {
+			const T gammaInv = T(1) / Standards<T>::sGamma;
+			const T k0Inv    = Standards<T>::sK0 / Standards<T>::sPhi;
+			const T a1       = T(1) + Standards<T>::sA;
+			const T phi      = Standards<T>::sPhi;
+			const T a        = Standards<T>::sA;
+			matBlock(blk, Standards<T>::sRGBmat);//XYZ -> linear rgb
+			for(size_t k = 0; k < 3; k++) {
+				T * const c = blk.c[k];
+				if(Gamma::Exact == gam) {
+					for(size_t j = 0; j < blk.n; j++) c[j] = c[j] <= k0Inv ? c[j] * phi : a1 * std::pow(c[j], gammaInv) - a;//gamma correction
+				} else {
+					sRGBTransfer<T>().encode(c, blk.n, gam);//approximate gamma correction
+				}
+			}
+			return clampBlock(blk);//separate loop so the clamp vectorizes even when std::pow doesn't
+		}
+
+		//@brief    : block version of rgb2xyz
+		//@param blk: block of colors to convert in place
+		//@param gam: evaluation strategy for the sRGB transfer function
+		template <typename T> void rgb2xyzBlock(Block<T>& blk, const Gamma gam) {
+			const T a1  = T(1) + Standards<T>::sA;
+			const T k0  = Standards<T>::sK0;
+			const T phi = Standards<T>::sPhi;
+			const T a   = Standards<T>::sA;
+			const T g   = Standards<T>::sGamma;
+			for(size_t k = 0; k < 3; k++) {
+				T * const c = blk.c[k];
+				if(Gamma::Exact == gam) {
+					for(size_t j = 0; j < blk.n; j++) c[j] = c[j] <= k0 ? c[j] / phi : std::pow((c[j] + a) / a1, g);//gamma correction
+				} else {
+					sRGBTransfer<T>().decode(c, blk.n, gam);//approximate gamma correction
+				}
+			}
+			matBlock(blk, Standards<T>::sRGBmatInv);//linear rgb -> XYZ
+		}
+
+		//@brief : get a table of linear values for every code of an integer sRGB channel
+		//@return: table with numeric_limits<I>::max() + 1 entries (constructed on first use)
+		template <typename T, typename I> const std::vector<T>& sRGBLinearTable() {
+			static const std::vector<T> lut = [](){
+				const size_t maxCode = std::numeric_limits<I>::max();
+				std::vector<T> v(maxCode + 1);
+				for(size_t i = 0; i <= maxCode; i++) v[i] = T(i) / T(maxCode);
+				sRGBTransfer<T>().decode(v.data(), v.size(), Gamma::Exact);//linearize every code once
+				return v;
+			}();
+			return lut;
+		}
+
+		//@brief       : linearize integer sRGB colors from an array into a block
+		//@param src   : array of integer sRGB colors to copy from
+		//@param count : total number of colors in src (distance between channels for planar data)
+		//@param i     : index of first color to copy
+		//@param layout: memory layout of src
+		//@param stride: distance between consecutive colors for interleaved data
+		//@param blk   : block to write linear rgb into (blk.n colors are copied)
+		template <typename T, typename I> void linearizeBlock(I const * const src, const size_t count, const size_t i, const Layout layout, const size_t stride, Block<T>& blk) {
+			T const * const lut = sRGBLinearTable<T, I>().data();
+			if(Layout::Planar == layout) {
+				for(size_t k = 0; k < 3; k++) {
+					I const * const p = src + k * count + i;
+					for(size_t j = 0; j < blk.n; j++) blk.c[k][j] = lut[p[j]];
+				}
+			} else {
+				I const * const p = src + stride * i;
+				for(size_t j = 0; j < blk.n; j++) {
+					blk.c[0][j] = lut[p[stride*j+0]];
+					blk.c[1][j] = lut[p[stride*j+1]];
+					blk.c[2][j] = lut[p[stride*j+2]];
+				}
+			}
+		}
+
+		//@brief       : convert an array of integer sRGB colors block by block
+		//@param rgb   : integer sRGB colors to convert
+		//@param out   : location to write converted colors
+		//@param n     : number of colors
+		//@param layout: memory layout of rgb and out
+		//@param stride: distance between consecutive colors in rgb for interleaved data
+		//@param kernel: function to convert a block of XYZ colors in place, void(Block<T>&)
+		template <typename T, typename I, typename Kernel> void intBatch(I const * const rgb, T * const out, const size_t n, const Layout layout, const size_t stride, Kernel kernel) {
+			Block<T> blk;
+			for(size_t i = 0; i < n; i += BatchSize) {
+				blk.n = std::min(BatchSize, n - i);
+				linearizeBlock(rgb, n, i, layout, stride, blk);//sRGB -> linear rgb
+				matBlock(blk, Standards<T>::sRGBmatInv);//linear rgb -> XYZ
+				kernel(blk);
+				storeBlock(blk, out, n, i, layout);
+			}
+		}
+
+		//@brief    : block version of xyz2lab
+		//@param blk: block of colors to convert in place
+		//@param ill: Lab illuminant as XYZ (or NULL to use illuminant D65 for a 2 degree observer)
+		template <typename T> void xyz2labBlock(Block<T>& blk, T const * ill) {
+			const T delta = T(6) / 29;
+			const T d2 = delta * delta * 3;
+			const T d3 = delta * delta * delta;
+			const T k = T(4) / 29;
+			T const * const illum = (NULL != ill) ? ill : Standards<T>::D65_2;
+			for(size_t i = 0; i < 3; i++) {
+				const T w = illum[i] / illum[1];//white point normalization
+				T * const c = blk.c[i];
+				for(size_t j = 0; j < blk.n; j++) {
+					const T t = c[j] / w;
+					const T r = fastCbrt(t);//evaluate both branches so the loop is vectorizable
+					c[j] = blend(t > d3, r, t / d2 + k);//apply nonlinear scaling
+				}
+			}
+			T * const c0 = blk.c[0];
+			T * const c1 = blk.c[1];
+			T * const c2 = blk.c[2];
+			for(size_t j = 0; j < blk.n; j++) {
+				const T fx = c0[j], fy = c1[j], fz = c2[j];
+				c0[j] = fy * 116 - 16;//L*
+				c1[j] = (fx - fy) * 500;//a*
+				c2[j] = (fy - fz) * 200;//b*
+			}
+		}
+
+		//@brief    : block version of lab2xyz
+		//@param blk: block of colors to convert in place
+		//@param ill: Lab illuminant as XYZ (or NULL to use illuminant D65 for a 2 degree observer)
+		template <typename T> void lab2xyzBlock(Block<T>& blk, T const * ill) {
+			const T delta = T(6) / 29;
+			const T d2 = delta * delta * 3;
+			const T k = T(4) / 29;
+			T * const c0 = blk.c[0];
+			T * const c1 = blk.c[1];
+			T * const c2 = blk.c[2];
+			for(size_t j = 0; j < blk.n; j++) {
+				const T Ln = (c0[j] + T(16)) / 116;
+				const T a = c1[j], b = c2[j];
+				c0[j] = Ln + a / 500;
+				c1[j] = Ln;
+				c2[j] = Ln - b / 200;
+			}
+			T const * const illum = (NULL != ill) ? ill : Standards<T>::D65_2;
+			for(size_t i = 0; i < 3; i++) {
+				const T w = illum[i] / illum[1];//white point normalization
+				T * const c = blk.c[i];
+				for(size_t j = 0; j < blk.n; j++) c[j] = blend(c[j] > delta, c[j] * c[j] * c[j], d2 * (c[j] - k)) * w;//remove nonlinear scaling and white point normalization
+			}
+		}
+
+		//@brief    : block version of xyz2luv
+		//@param blk: block of colors to convert in place
+		//@param ill: Luv illuminant as XYZ (or NULL to use illuminant D65 for a 2 degree observer)
+		template <typename T> void xyz2luvBlock(Block<T>& blk, T const * ill) {
+			const T d   = T(216) / 24389;//(6/29)^3
+			const T d_8 = T(8) / d;//(29/3)^3
+			T const * const illum = (NULL != ill) ? ill : Standards<T>::D65_2;
+			const T denn = (illum[0] + illum[1] * 15 + illum[2] * 3) / illum[1];
+			const T un = (illum[0] / illum[1]) / denn;
+			const T vn = T(1) / denn;
+			T * const c0 = blk.c[0];
+			T * const c1 = blk.c[1];
+			T * const c2 = blk.c[2];
+			for(size_t j = 0; j < blk.n; j++) {
+				const T x = c0[j], y = c1[j], z = c2[j];
+				const T den = x + y * 15 + z * 3;
+				const bool zero = T(0) == den;
+				const T u = blend(zero, T(0), x / den) - un;
+				const T v = blend(zero, T(0), y / den) - vn;
+				const T r = fastCbrt(y);//evaluate both branches so the loop is vectorizable
+				const T L = blend(y <= d, y * d_8, r * 116 - 16);
+				c0[j] = L;
+				c1[j] = L *  52 * u;
+				c2[j] = L * 117 * v;
+			}
+		}
+
+		//@brief    : block version of luv2xyz
+		//@param blk: block of colors to convert in place
+		//@param ill: Luv illuminant as XYZ (or NULL to use illuminant D65 for a 2 degree observer)
+		template <typename T> void luv2xyzBlock(Block<T>& blk, T const * ill) {
+			const T d = T(27) / 24389;//(3/29)^3
+			T const * const illum = (NULL != ill) ? ill : Standards<T>::D65_2;
+			const T denn = (illum[0] + illum[1] * 15 + illum[2] * 3) / illum[1];
+			const T un = (illum[0] / illum[1]) * 4 / denn;
+			const T vn = T(9) / denn;
+			T * const c0 = blk.c[0];
+			T * const c1 = blk.c[1];
+			T * const c2 = blk.c[2];
+			for(size_t j = 0; j < blk.n; j++) {
+				const T L = c0[j], u = c1[j], v = c2[j];
+				const T up = (u / 13 + L * un) * 3;
+				const T vp = (v / 13 + L * vn) * 4;
+				const T Lp = (L + 16) / 116;
+				const T y = blend(L <= 8, L * d, Lp * Lp * Lp);
+				const bool zero = T(0) == L;//handle L* = 0
+				c0[j] = blend(zero, T(0), y * (up * 3) / vp);
+				c1[j] = blend(zero, T(0), y);
+				c2[j] = blend(zero, T(0), y * (T(12) * L - up - vp * 5) / vp);
+			}
+		}
+
+		//@brief    : block versions of pixel wise conversions
+		//@param blk: block of colors to convert in place
+		template <typename T> void hsv2rgbBlock(Block<T>& blk) {pixelBlock<T>(blk, hsv2rgb<T>);}
+		template <typename T> void hsl2rgbBlock(Block<T>& blk) {pixelBlock<T>(blk, hsl2rgb<T>);}
+		template <typename T> void rgb2hsvBlock(Block<T>& blk) {pixelBlock<T>(blk, rgb2hsv<T>);}
+		template <typename T> void rgb2hslBlock(Block<T>& blk) {pixelBlock<T>(blk, rgb2hsl<T>);}
+		template <typename T> void hsv2hslBlock(Block<T>& blk) {pixelBlock<T>(blk, hsv2hsl<T>);}
+		template <typename T> void hsl2hsvBlock(Block<T>& blk) {pixelBlock<T>(blk, hsl2hsv<T>);}
+
+		//@brief: Luv -> rgb lookup table sampled on a regular lattice and evaluated with tetrahedral interpolation
+		//@note : the lattice axes are L*, u*/L*, and v*/L* (equivalent to L* + chromaticity) instead of L*, u*, v*, near black the
+		//        in gamut u*/v* range shrinks to a point and the v' = 0 singularity of Luv -> XYZ crowds the blue corner of the gamut
+		//        so a uniform Luv lattice would need far more points to resolve dark colors
+		template <typename T>
+		class Lattice {
+			public:
+				//@brief     : sample a profile on a lattice and measure the resulting error
+				//@param prof: profile to sample (must convert exactly)
+				//@param n   : number of lattice points along each axis (>= 2)
+				Lattice(const Profile<T>& prof, const size_t n);
+
+				//@brief    : interpolate the rgb color for a Luv value
+				//@param luv: Luv value to convert
+				//@param rgb: location to write rgb value (can be the same as luv)
+				//@return   : true/false if the value falls outside/inside the rgb gamut (and was clamped)
+				bool interpolate(T const * const luv, T * const rgb) const;
+
+				//@brief    : interpolate the rgb colors for a block of Luv values
+				//@param blk: block of Luv values to convert in place
+				//@return   : true/false if any value fell outside/inside the rgb gamut (and was clamped)
+				bool interpolate(Block<T>& blk) const;
+
+				//@brief : get the largest error measured during construction
+				//@return: max Delta E*uv at in gamut cell centers and on a grid over the rgb cube faces twice as fine as the lattice
+				T maxDeltaE() const {return dE;}
+
+				static constexpr T Pad       = T(0.15);//fraction of the gamut's chromaticity range to extend the lattice by (for slightly out of gamut colors)
+				static constexpr T Margin[2] = {T(-0.5), T(1.5)};//range of stored (unclamped) rgb values
+
+			private:
+				size_t         n    ;//points along each axis
+				T              lo[3];//lower bound of lattice in L*, u*/L*, v*/L*
+				T              sc[3];//scale from lattice coordinates to fractional lattice index
+				std::vector<T> data ;//unclamped {r, g, b} for each lattice point, v*/L* fastest
+				T              dE   ;//max measured error
+		};
+
+		template <typename T> constexpr T Lattice<T>::Pad      ;
+		template <typename T> constexpr T Lattice<T>::Margin[2];
+
+		//@brief     : sample a profile on a lattice and measure the resulting error
+		//@param prof: profile to sample (must convert exactly)
+		//@param n   : number of lattice points along each axis (>= 2)
+		template <typename T>
+		Lattice<T>::Lattice(const Profile<T>& prof, const size_t n) : n(std::max<size_t>(n, 2)), data(this->n * this->n * this->n * 3), dE(0) {
+			//the chromaticity of every color in the gamut lies in the triangle spanned by the primaries
+			T hi[3] = {T(100), T(0), T(0)};//the white point (0, 0) is always inside the triangle
+			lo[0] = lo[1] = lo[2] = T(0);
+			for(size_t k = 0; k < 3; k++) {
+				T c[3] = {T(0), T(0), T(0)};
+				c[k] = T(1);
+				prof.rgb2luv(c, c);
+				for(size_t i = 1; i < 3; i++) {
+					lo[i] = std::min(lo[i], c[i] / c[0]);
+					hi[i] = std::max(hi[i], c[i] / c[0]);
+				}
+			}
+			for(size_t i = 1; i < 3; i++) {
+				const T pad = (hi[i] - lo[i]) * Pad;
+				lo[i] -= pad;
+				hi[i] += pad;
+			}
+
+			//sample exact conversion at lattice points
+			const size_t m = this->n;
+			for(size_t k = 0; k < 3; k++) sc[k] = T(m - 1) / (hi[k] - lo[k]);
+			for(size_t i = 0; i < m; i++) {
+				const T L = lo[0] + T(i) / sc[0];
+				for(size_t j = 0; j < m; j++) {
+					for(size_t k = 0; k < m; k++) {
+						const T luv[3] = {L, (lo[1] + T(j) / sc[1]) * L, (lo[2] + T(k) / sc[2]) * L};
+						T * const p = data.data() + ((i * m + j) * m + k) * 3;
+						prof.luv2lin(luv, p);
+						for(size_t c = 0; c < 3; c++) {//gamma correct without clamping so interpolation is smooth across the gamut boundary
+							const T v = prof.transfer().encode(std::fabs(p[c]), Gamma::Exact);
+							p[c] = std::max(Margin[0], std::min(Margin[1], std::signbit(p[c]) ? -v : v));//limit extrapolated values
+						}
+					}
+				}
+			}
+
+			//measure error at cell centers (furthest from the samples) for colors that are inside the gamut
+			auto measure = [&](T const * const luv, T const * const exact) {
+				T approx[3], ref[3];
+				interpolate(luv, approx);
+				prof.rgb2luv(exact , ref   );
+				prof.rgb2luv(approx, approx);
+				T d2 = 0;
+				for(size_t c = 0; c < 3; c++) d2 += (ref[c] - approx[c]) * (ref[c] - approx[c]);
+				dE = std::max(dE, std::sqrt(d2));
+			};
+			for(size_t i = 0; i + 1 < m; i++) {
+				const T L = lo[0] + (T(i) + T(0.5)) / sc[0];
+				for(size_t j = 0; j + 1 < m; j++) {
+					for(size_t k = 0; k + 1 < m; k++) {
+						const T luv[3] = {L, (lo[1] + (T(j) + T(0.5)) / sc[1]) * L, (lo[2] + (T(k) + T(0.5)) / sc[2]) * L};
+						T exact[3];
+						if(!prof.luv2rgb(luv, exact)) measure(luv, exact);//skip out of gamut colors
+					}
+				}
+			}
+
+			//cell centers near the gamut boundary are mostly out of gamut but the largest errors are just inside it (where the clamped
+			//rgb cube cuts through cells), so also measure a grid on the faces of the rgb cube twice as fine as the lattice
+			const size_t g = 2 * (m - 1) + 1;//grid points along each edge of the rgb cube
+			for(size_t f = 0; f < 6; f++) {//loop over faces
+				for(size_t i = 0; i < g; i++) {
+					for(size_t j = 0; j < g; j++) {
+						T rgb[3];
+						rgb[ f % 3         ] = T(f / 3);//fixed channel (0 or 1)
+						rgb[(f % 3 + 1) % 3] = T(i) / (g - 1);
+						rgb[(f % 3 + 2) % 3] = T(j) / (g - 1);
+						T luv[3];
+						prof.rgb2luv(rgb, luv);
+						measure(luv, rgb);
+					}
+				}
+			}
+		}
+
+		//@brief    : interpolate the rgb color for a Luv value
+		//@param luv: Luv value to convert
+		//@param rgb: location to write rgb value (can be the same as luv)
+		//@return   : true/false if the value falls outside/inside the rgb gamut (and was clamped)
+		template <typename T>
+		bool Lattice<T>::interpolate(T const * const luv, T * const rgb) const {
+			//convert to lattice coordinates and find containing cell and fractional position within it
+			const T top = T(n - 1);
+			const T iL = luv[0] > T(0) ? T(1) / luv[0] : T(0);//chromaticity is irrelevant at (and below) black
+			const T x[3] = {luv[0], luv[1] * iL, luv[2] * iL};
+			const int last = (int)n - 2;//index of last cell
+			int idx[3];
+			T f[3];
+			for(size_t k = 0; k < 3; k++) {
+				const T xi = std::max(T(0), std::min(top, (x[k] - lo[k]) * sc[k]));//clamp to lattice
+				idx[k] = std::min((int)xi, last);//int conversion is much cheaper than size_t
+				f[k] = xi - T(idx[k]);
+			}
+
+			//pick the tetrahedron containing the point by ordering the fractional coordinates (the path from c000 to c111 steps along
+			//the axis with the largest fraction first), ranks are computed without branches since the order is unpredictable
+			const size_t s[3] = {n * n * 3, n * 3, 3};//strides along each axis
+			const size_t g01 = f[0] >= f[1], g02 = f[0] >= f[2], g12 = f[1] >= f[2];
+			const size_t r[3] = {2 - g01 - g02, 1 + g01 - g12, g02 + g12};//rank of each fraction (0 -> largest)
+			T w[3];
+			for(size_t k = 0; k < 3; k++) w[r[k]] = f[k];//fractions sorted from largest to smallest
+			T const * const c0 = data.data() + ((idx[0] * n + idx[1]) * n + idx[2]) * 3;
+			T const * const c1 = c0 + (0 == r[0] ? s[0] : 0) + (0 == r[1] ? s[1] : 0) + (0 == r[2] ? s[2] : 0);
+			T const * const c2 = c0 + (2 != r[0] ? s[0] : 0) + (2 != r[1] ? s[1] : 0) + (2 != r[2] ? s[2] : 0);
+			T const * const c3 = c0 + s[0] + s[1] + s[2];
+			const T w1 = w[0], w2 = w[1], w3 = w[2];
+			bool clamped = false;
+			for(size_t k = 0; k < 3; k++) {
+				const T v = c0[k] + (c1[k] - c0[k]) * w1 + (c2[k] - c1[k]) * w2 + (c3[k] - c2[k]) * w3;
+				const bool lo = std::signbit(v);
+				const bool hi = v > T(1);
+				rgb[k] = lo ? T(0) : (hi ? T(1) : v);//clamp to gamut
+				clamped |= lo || hi;
+			}
+			return clamped;
+		}
+
+		//@brief    : interpolate the rgb colors for a block of Luv values
+		//@param blk: block of Luv values to convert in place
+		//@return   : true/false if any value fell outside/inside the rgb gamut (and was clamped)
+		template <typename T>
+		bool Lattice<T>::interpolate(Block<T>& blk) const {
+			bool clamped = false;
+			for(size_t j = 0; j < blk.n; j++) {
+				T c[3] = {blk.c[0][j], blk.c[1][j], blk.c[2][j]};
+				if(interpolate(c, c)) clamped = true;
+				for(size_t k = 0; k < 3; k++) blk.c[k][j] = c[k];
+			}
+			return clamped;
+		}
+	}
+
+	////////////////////////////////////////////
+	//   implementation of batched versions   //
+	////////////////////////////////////////////
+
+	//direct conversions
+	template <typename T> bool xyz2rgb(T const * const xyz, T * const rgb, const size_t n, const Layout layout, const Gamma gam) {return detail::batch(xyz, rgb, n, layout, [gam](detail::Block<T>& b)->bool{return detail::xyz2rgbBlock(b, gam);                              });}
+	template <typename T> void rgb2xyz(T const * const rgb, T * const xyz, const size_t n, const Layout layout, const Gamma gam) {       detail::batch(rgb, xyz, n, layout, [gam](detail::Block<T>& b)->bool{detail::rgb2xyzBlock(b, gam);      return false;                  });}
+	template <typename T> void xyz2lab(T const * const xyz, T * const lab, const size_t n, const Layout layout, T const * ill) {       detail::batch(xyz, lab, n, layout, [ill](detail::Block<T>& b)->bool{detail::xyz2labBlock(b, ill); return false;                  });}
+	template <typename T> void lab2xyz(T const * const lab, T * const xyz, const size_t n, const Layout layout, T const * ill) {       detail::batch(lab, xyz, n, layout, [ill](detail::Block<T>& b)->bool{detail::lab2xyzBlock(b, ill); return false;                  });}
+	template <typename T> void xyz2luv(T const * const xyz, T * const luv, const size_t n, const Layout layout, T const * ill) {       detail::batch(xyz, luv, n, layout, [ill](detail::Block<T>& b)->bool{detail::xyz2luvBlock(b, ill); return false;                  });}
+	template <typename T> void luv2xyz(T const * const luv, T * const xyz, const size_t n, const Layout layout, T const * ill) {       detail::batch(luv, xyz, n, layout, [ill](detail::Block<T>& b)->bool{detail::luv2xyzBlock(b, ill); return false;                  });}
+	template <typename T> void hsv2rgb(T const * const hsv, T * const rgb, const size_t n, const Layout layout               ) {       detail::batch(hsv, rgb, n, layout, [   ](detail::Block<T>& b)->bool{detail::hsv2rgbBlock(b);      return false;                  });}
+	template <typename T> void hsl2rgb(T const * const hsl, T * const rgb, const size_t n, const Layout layout               ) {       detail::batch(hsl, rgb, n, layout, [   ](detail::Block<T>& b)->bool{detail::hsl2rgbBlock(b);      return false;                  });}
+	template <typename T> void hsl2hsv(T const * const hsl, T * const hsv, const size_t n, const Layout layout               ) {       detail::batch(hsl, hsv, n, layout, [   ](detail::Block<T>& b)->bool{detail::hsl2hsvBlock(b);      return false;                  });}
+	template <typename T> void hsv2hsl(T const * const hsv, T * const hsl, const size_t n, const Layout layout               ) {       detail::batch(hsv, hsl, n, layout, [   ](detail::Block<T>& b)->bool{detail::hsv2hslBlock(b);      return false;                  });}
+	template <typename T> void rgb2hsv(T const * const rgb, T * const hsv, const size_t n, const Layout layout               ) {       detail::batch(rgb, hsv, n, layout, [   ](detail::Block<T>& b)->bool{detail::rgb2hsvBlock(b);      return false;                  });}
+	template <typename T> void rgb2hsl(T const * const rgb, T * const hsl, const size_t n, const Layout layout               ) {       detail::batch(rgb, hsl, n, layout, [   ](detail::Block<T>& b)->bool{detail::rgb2hslBlock(b);      return false;                  });}
+
+	//illuminant free cie spaces -> hsl/hsv
+	template <typename T> bool xyz2hsv(T const * const xyz, T * const hsv, const size_t n, const Layout layout               ) {return detail::batch(xyz, hsv, n, layout, [   ](detail::Block<T>& b)->bool{const bool c = detail::xyz2rgbBlock(b, Gamma::Exact); detail::rgb2hsvBlock(b); return c;});}//xyz->rgb->hsv
+	template <typename T> bool xyz2hsl(T const * const xyz, T * const hsl, const size_t n, const Layout layout               ) {return detail::batch(xyz, hsl, n, layout, [   ](detail::Block<T>& b)->bool{const bool c = detail::xyz2rgbBlock(b, Gamma::Exact); detail::rgb2hslBlock(b); return c;});}//xyz->rgb->hsl
+
+	//illuminated cie spaces -> rgb/hsv/hsl
+	template <typename T> bool luv2rgb(T const * const luv, T * const rgb, const size_t n, const Layout layout, T const * ill, const Gamma gam) {return detail::batch(luv, rgb, n, layout, [ill,gam](detail::Block<T>& b)->bool{detail::luv2xyzBlock(b, ill); return detail::xyz2rgbBlock(b, gam);                                           });}//luv->xyz->rgb
+	template <typename T> bool luv2hsv(T const * const luv, T * const hsv, const size_t n, const Layout layout, T const * ill) {return detail::batch(luv, hsv, n, layout, [ill](detail::Block<T>& b)->bool{detail::luv2xyzBlock(b, ill); const bool c = detail::xyz2rgbBlock(b, Gamma::Exact); detail::rgb2hsvBlock(b); return c;});}//luv->xyz->rgb->hsv
+	template <typename T> bool luv2hsl(T const * const luv, T * const hsl, const size_t n, const Layout layout, T const * ill) {return detail::batch(luv, hsl, n, layout, [ill](detail::Block<T>& b)->bool{detail::luv2xyzBlock(b, ill); const bool c = detail::xyz2rgbBlock(b, Gamma::Exact); detail::rgb2hslBlock(b); return c;});}//luv->xyz->rgb->hsl
+	template <typename T> bool lab2rgb(T const * const lab, T * const rgb, const size_t n, const Layout layout, T const * ill, const Gamma gam) {return detail::batch(lab, rgb, n, layout, [ill,gam](detail::Block<T>& b)->bool{detail::lab2xyzBlock(b, ill); return detail::xyz2rgbBlock(b, gam);                                           });}//lab->xyz->rgb
+	template <typename T> bool lab2hsv(T const * const lab, T * const hsv, const size_t n, const Layout layout, T const * ill) {return detail::batch(lab, hsv, n, layout, [ill](detail::Block<T>& b)->bool{detail::lab2xyzBlock(b, ill); const bool c = detail::xyz2rgbBlock(b, Gamma::Exact); detail::rgb2hsvBlock(b); return c;});}//lab->xyz->rgb->hsv
+	template <typename T> bool lab2hsl(T const * const lab, T * const hsl, const size_t n, const Layout layout, T const * ill) {return detail::batch(lab, hsl, n, layout, [ill](detail::Block<T>& b)->bool{detail::lab2xyzBlock(b, ill); const bool c = detail::xyz2rgbBlock(b, Gamma::Exact); detail::rgb2hslBlock(b); return c;});}//lab->xyz->rgb->hsl
+
+	//within cie spaces (through xyz)
+	template <typename T> void luv2lab(T const * const luv, T * const lab, const size_t n, const Layout layout, T const * ill) {detail::batch(luv, lab, n, layout, [ill](detail::Block<T>& b)->bool{detail::luv2xyzBlock(b, ill); detail::xyz2labBlock(b, ill); return false;});}//luv->xyz->lab
+	template <typename T> void lab2luv(T const * const lab, T * const luv, const size_t n, const Layout layout, T const * ill) {detail::batch(lab, luv, n, layout, [ill](detail::Block<T>& b)->bool{detail::lab2xyzBlock(b, ill); detail::xyz2luvBlock(b, ill); return false;});}//lab->xyz->luv
+
+	//rgb/hsv/hsl to cie spaces (all go through rgb -> xyz)
+	template <typename T> void rgb2luv(T const * const rgb, T * const luv, const size_t n, const Layout layout, T const * ill, const Gamma gam) {detail::batch(rgb, luv, n, layout, [ill,gam](detail::Block<T>& b)->bool{                          detail::rgb2xyzBlock(b, gam); detail::xyz2luvBlock(b, ill); return false;});}//     rgb->xyz->luv
+	template <typename T> void rgb2lab(T const * const rgb, T * const lab, const size_t n, const Layout layout, T const * ill, const Gamma gam) {detail::batch(rgb, lab, n, layout, [ill,gam](detail::Block<T>& b)->bool{                          detail::rgb2xyzBlock(b, gam); detail::xyz2labBlock(b, ill); return false;});}//     rgb->xyz->lab
+	template <typename T> void hsv2xyz(T const * const hsv, T * const xyz, const size_t n, const Layout layout               ) {detail::batch(hsv, xyz, n, layout, [   ](detail::Block<T>& b)->bool{detail::hsv2rgbBlock(b); detail::rgb2xyzBlock(b, Gamma::Exact);                                return false;});}//hsv->rgb->xyz
+	template <typename T> void hsv2luv(T const * const hsv, T * const luv, const size_t n, const Layout layout, T const * ill) {detail::batch(hsv, luv, n, layout, [ill](detail::Block<T>& b)->bool{detail::hsv2rgbBlock(b); detail::rgb2xyzBlock(b, Gamma::Exact); detail::xyz2luvBlock(b, ill); return false;});}//hsv->rgb->xyz->luv
+	template <typename T> void hsv2lab(T const * const hsv, T * const lab, const size_t n, const Layout layout, T const * ill) {detail::batch(hsv, lab, n, layout, [ill](detail::Block<T>& b)->bool{detail::hsv2rgbBlock(b); detail::rgb2xyzBlock(b, Gamma::Exact); detail::xyz2labBlock(b, ill); return false;});}//hsv->rgb->xyz->lab
+	template <typename T> void hsl2xyz(T const * const hsl, T * const xyz, const size_t n, const Layout layout               ) {detail::batch(hsl, xyz, n, layout, [   ](detail::Block<T>& b)->bool{detail::hsl2rgbBlock(b); detail::rgb2xyzBlock(b, Gamma::Exact);                                return false;});}//hsl->rgb->xyz
+	template <typename T> void hsl2luv(T const * const hsl, T * const luv, const size_t n, const Layout layout, T const * ill) {detail::batch(hsl, luv, n, layout, [ill](detail::Block<T>& b)->bool{detail::hsl2rgbBlock(b); detail::rgb2xyzBlock(b, Gamma::Exact); detail::xyz2luvBlock(b, ill); return false;});}//hsl->rgb->xyz->luv
+	template <typename T> void hsl2lab(T const * const hsl, T * const lab, const size_t n, const Layout layout, T const * ill) {detail::batch(hsl, lab, n, layout, [ill](detail::Block<T>& b)->bool{detail::hsl2rgbBlock(b); detail::rgb2xyzBlock(b, Gamma::Exact); detail::xyz2labBlock(b, ill); return false;});}//hsl->rgb->xyz->lab
+
+	//integer sRGB to cie spaces (through linearization tables)
+	template <typename T> void rgb2xyz(uint8_t  const * const rgb, T * const xyz, const size_t n, const Layout layout,                const size_t stride) {detail::intBatch(rgb, xyz, n, layout, stride, [   ](detail::Block<T>&  ){                             });}
+	template <typename T> void rgb2luv(uint8_t  const * const rgb, T * const luv, const size_t n, const Layout layout, T const * ill, const size_t stride) {detail::intBatch(rgb, luv, n, layout, stride, [ill](detail::Block<T>& b){detail::xyz2luvBlock(b, ill);});}//rgb->xyz->luv
+	template <typename T> void rgb2lab(uint8_t  const * const rgb, T * const lab, const size_t n, const Layout layout, T const * ill, const size_t stride) {detail::intBatch(rgb, lab, n, layout, stride, [ill](detail::Block<T>& b){detail::xyz2labBlock(b, ill);});}//rgb->xyz->lab
+	template <typename T> void rgb2xyz(uint16_t const * const rgb, T * const xyz, const size_t n, const Layout layout,                const size_t stride) {detail::intBatch(rgb, xyz, n, layout, stride, [   ](detail::Block<T>&  ){                             });}
+	template <typename T> void rgb2luv(uint16_t const * const rgb, T * const luv, const size_t n, const Layout layout, T const * ill, const size_t stride) {detail::intBatch(rgb, luv, n, layout, stride, [ill](detail::Block<T>& b){detail::xyz2luvBlock(b, ill);});}//rgb->xyz->luv
+	template <typename T> void rgb2lab(uint16_t const * const rgb, T * const lab, const size_t n, const Layout layout, T const * ill, const size_t stride) {detail::intBatch(rgb, lab, n, layout, stride, [ill](detail::Block<T>& b){detail::xyz2labBlock(b, ill);});}//rgb->xyz->lab
+
+	////////////////////////////////////////////
+	//        implementation of Profile       //
+	////////////////////////////////////////////
+
+	//@brief      : construct a profile for an rgb color space
+	//@param rgb  : chromaticity of {red point, green point, blue point} as xyz (e.g. detail::Standards<T>::adobeRGB)
+	//@param w    : chromaticity of rgb white point as xyz
+	//@param a    : deviation of gamma correction coefficient from 1
+	//@param gamma: gamma exponent
+	//@param phi  : scale factor for linear region of transfer function
+	//@param k0   : cutoff for linear region in gamma corrected space (0 for a pure power law)
+	//@param ill  : Luv illuminant as xyz (or NULL to use the rgb white point so that Luv neutrals are rgb neutrals)
+	template <typename T>
+	Profile<T>::Profile(const T rgb[3][3], T const * const w, const T a, const T gamma, const T phi, const T k0, T const * const ill) :
+		xyzMat(detail::rgbMat(rgb, w)),
+		rgbMat(detail::inv3x3(xyzMat)),
+		trc(a, gamma, phi, k0) {
+		//compute white point constants once
+		T const * const illum = (NULL != ill) ? ill : w;
+		const T denn = (illum[0] + illum[1] * 15 + illum[2] * 3) / illum[1];
+		un = (illum[0] / illum[1]) / denn;
+		vn = T(1) / denn;
+
+		//luv2xyz computes u' = 3 * (u* / 13 + L* * 4 * un), v' = 4 * (v* / 13 + L* * 9 * vn) and XYZ = Y / v' * {3 u', v', 12 L* - u' - 5 v'}
+		//the bracketed vector is linear in Luv so it can be fused with the xyz -> linear rgb matrix
+		const T u4 = un * 4, v9 = vn * 9;
+		const std::array<T, 9> A = {
+			u4 * 9                   , T(  9) / 13, T(  0)     ,//3 u'
+			v9 * 4                   , T(  0)     , T(  4) / 13,//v'
+			T(12) - u4 * 3 - v9 * 20 , T( -3) / 13, T(-20) / 13,//12 L* - u' - 5 v'
+		};
+		for(size_t i = 0; i < 3; i++) {
+			for(size_t j = 0; j < 3; j++) luvMat[3*i+j] = xyzMat[3*i+0] * A[0+j] + xyzMat[3*i+1] * A[3+j] + xyzMat[3*i+2] * A[6+j];
+		}
+		vL = A[3];
+		vv = A[5];
+
+		//build fixed point versions of the fused matrix and transfer function
+		const T one = T(1 << 16);
+		for(size_t i = 0; i < 9; i++) luvFix[i] = (int32_t)std::lround(std::ldexp(luvMat[i], 26));
+		vLFix = (int32_t)std::lround(vL * one);
+		vvFix = (int32_t)std::lround(vv * one);
+		//evenly spaced samples are too coarse near black where a pure power law has unbounded slope so sample in octaves of x = lin + 2^FixLow (Q24)
+		//the first octave is evenly spaced at 2^(FixLow-FixMant) = 1 step of lin so the darkest values aren't interpolated at all (a coarser first octave is ~0.3 codes off for gamma 2.2)
+		//octFix finds the octave of x with one lookup after shifting x < 2^FixOct up by FixOct
+		const size_t mant = size_t(1) << FixMant;
+		encFix.resize(((24 - FixLow) << FixMant) + 2);
+		for(size_t i = 0; i < encFix.size(); i++) {
+			const int64_t x = int64_t((i % mant) + mant) << (FixLow + i / mant - FixMant);
+			const T lin = std::min(T(x - (int64_t(1) << FixLow)) / (1 << 24), T(1));//the padding entry is past 1
+			encFix[i] = (uint16_t)std::lround(trc.encode(lin, Gamma::Exact) * (255 * 256));
+		}
+		octFix.resize(((size_t(1) << 24) >> FixOct) + 2);
+		for(size_t i = 1; i < octFix.size(); i++) {
+			uint8_t n = 0;
+			while((i << n) < ((size_t(1) << 24) >> FixOct)) ++n;
+			octFix[i] = n;
+		}
+	}
+
+	//@brief : predefined profiles (constructed on first use)
+	//@return: profile for the named color space
+	template <typename T> const Profile<T>& Profile<T>::sRGB    () {using namespace detail; static const Profile p(Standards<T>::sRGB    , Standards<T>::D65_2, Standards<T>::sA, Standards<T>::sGamma, Standards<T>::sPhi, Standards<T>::sK0); return p;}
+	template <typename T> const Profile<T>& Profile<T>::adobeRGB() {using namespace detail; static const Profile p(Standards<T>::adobeRGB, Standards<T>::D65_2, T(0)            , T(563) / 256        , T(1)              , T(0)             ); return p;}
+	template <typename T> const Profile<T>& Profile<T>::appleRGB() {using namespace detail; static const Profile p(Standards<T>::appleRGB, Standards<T>::D65_2, T(0)            , T(1.8)              , T(1)              , T(0)             ); return p;}
+	template <typename T> const Profile<T>& Profile<T>::palRGB  () {using namespace detail; static const Profile p(Standards<T>::palRGB  , Standards<T>::D65_2, T(0)            , T(2.2)              , T(1)              , T(0)             ); return p;}
+	template <typename T> const Profile<T>& Profile<T>::ntscRGB () {using namespace detail; static const Profile p(Standards<T>::ntscRGB , Standards<T>::D65_2, T(0)            , T(2.2)              , T(1)              , T(0)             ); return p;}
+	template <typename T> const Profile<T>& Profile<T>::cieRGB  () {using namespace detail; static const Profile p(Standards<T>::cieRGB  , Standards<T>::E    , T(0)            , T(2.2)              , T(1)              , T(0)             ); return p;}
+
+	//@brief  : check if two profiles describe the same rgb color space
+	//@param o: profile to compare against
+	//@return : true/false if the matrices, illuminant, and transfer function are / aren't identical
+	template <typename T>
+	bool Profile<T>::operator==(const Profile& o) const {
+		return this == &o || (xyzMat == o.xyzMat && rgbMat == o.rgbMat && un == o.un && vn == o.vn && trc == o.trc);//luvMat and the fixed point constants follow from these
+	}
+
+	//@brief    : convert from Luv to linear (not gamma corrected or clamped) rgb with the fused matrix
+	//@param luv: Luv value to convert
+	//@param lin: location to write linear rgb (can be the same as luv)
+	template <typename T>
+	void Profile<T>::luv2lin(T const * const luv, T * const lin) const {
+		static const T d = T(27) / 24389;//(3/29)^3
+		const T L  = luv[0], u = luv[1], v = luv[2];
+		const T Lp = (L + 16) / 116;
+		const T Y  = L <= 8 ? L * d : Lp * Lp * Lp;
+		const T s  = T(0) == L ? T(0) : Y / (L * vL + v * vv);//handle L* = 0
+		for(size_t i = 0; i < 3; i++) lin[i] = (L * luvMat[3*i] + u * luvMat[3*i+1] + v * luvMat[3*i+2]) * s;
+	}
+
+	//@brief    : convert between Luv/XYZ and rgb for this profile (same semantics as the free functions)
+	//@param abc: value to convert from abc color space
+	//@param ijk: location to write value converted to ijk color space (can be the same as parameter abc)
+	//@param gam: evaluation strategy for the transfer function
+	//@return   : true/false if the value falls outside/inside the rgb gamut (and was clamped)
+	template <typename T>
+	bool Profile<T>::xyz2rgb(T const * const xyz, T * const rgb, const Gamma gam) const {
+		T work[3];
+		for(size_t i = 0; i < 3; i++) work[i] = std::inner_product(xyz, xyz+3, xyzMat.begin() + 3*i, T(0));//XYZ -> linear rgb
+		trc.encode(work, 3, gam);//gamma correction
+		bool clamped = false;
+		for(size_t i = 0; i < 3; i++) {
+			const bool lo = std::signbit(work[i]);
+			const bool hi = work[i] > T(1);
+			rgb[i] = lo ? T(0) : (hi ? T(1) : work[i]);//clamp to gamut
+			clamped |= lo || hi;
+		}
+		return clamped;
+	}
+
+	template <typename T>
+	void Profile<T>::rgb2xyz(T const * const rgb, T * const xyz, const Gamma gam) const {
+		T work[3];
+		std::copy(rgb, rgb+3, work);
+		trc.decode(work, 3, gam);//gamma correction
+		for(size_t i = 0; i < 3; i++) xyz[i] = std::inner_product(work, work+3, rgbMat.begin() + 3*i, T(0));//linear rgb -> XYZ
+	}
+
+	template <typename T>
+	bool Profile<T>::luv2rgb(T const * const luv, T * const rgb, const Gamma gam) const {
+		if(lut) return lut->interpolate(luv, rgb);//lattice values are already gamma corrected
+		T work[3];
+		luv2lin(luv, work);
+		trc.encode(work, 3, gam);//gamma correction
+		bool clamped = false;
+		for(size_t i = 0; i < 3; i++) {
+			const bool lo = std::signbit(work[i]);
+			const bool hi = work[i] > T(1);
+			rgb[i] = lo ? T(0) : (hi ? T(1) : work[i]);//clamp to gamut
+			clamped |= lo || hi;
+		}
+		return clamped;
+	}
+
+	template <typename T>
+	void Profile<T>::rgb2luv(T const * const rgb, T * const luv, const Gamma gam) const {
+		static const T d   = T(216) / 24389;//(6/29)^3
+		static const T d_8 = T(8) / d;//(29/3)^3
+		T xyz[3];
+		rgb2xyz(rgb, xyz, gam);
+		const T den  = xyz[0] + xyz[1] * 15 + xyz[2] * 3;
+		const bool zero = T(0) == den;
+		const T u = (zero ? T(0) : xyz[0] / den) - un;
+		const T v = (zero ? T(0) : xyz[1] / den) - vn;
+		luv[0] = xyz[1] <= d ? xyz[1] * d_8 : std::cbrt(xyz[1]) * 116 - 16;
+		luv[1] = luv[0] *  52 * u;
+		luv[2] = luv[0] * 117 * v;
+	}
+
+	//@brief: batched versions of luv2rgb and rgb2luv (see batched free functions for parameters)
+	template <typename T>
+	bool Profile<T>::luv2rgb(T const * const luv, T * const rgb, const size_t n, const Layout layout, const Gamma gam) const {
+		return detail::batch(luv, rgb, n, layout, [this, gam](detail::Block<T>& b)->bool{
+			if(lut) return lut->interpolate(b);//lattice values are already gamma corrected
+			linBlock(b);//Luv -> linear rgb
+			for(size_t k = 0; k < 3; k++) trc.encode(b.c[k], b.n, gam);//gamma correction
+			return detail::clampBlock(b);
+		});
+	}
+
+	template <typename T>
+	void Profile<T>::rgb2luv(T const * const rgb, T * const luv, const size_t n, const Layout layout, const Gamma gam) const {
+		const T ill[3] = {un / vn, T(1), (T(1) / vn - un / vn - 15) / 3};//recover illuminant (normalized to Y = 1) from un and vn
+		detail::batch(rgb, luv, n, layout, [this, gam, &ill](detail::Block<T>& b)->bool{
+			for(size_t k = 0; k < 3; k++) trc.decode(b.c[k], b.n, gam);//gamma correction
+			detail::matBlock(b, rgbMat);//linear rgb -> XYZ
+			detail::xyz2luvBlock(b, ill);
+			return false;
+		});
+	}
+
+	//@brief: fused Luv -> 8 bit rgb (see declaration for parameters)
+	template <typename T>
+	bool Profile<T>::luv2rgb8(T const * const luv, uint8_t * const rgb, const size_t n, const bool alpha, const Gamma gam) const {
+		const size_t stride = alpha ? 4 : 3;
+		detail::Block<T> blk;
+		bool clamped = false;
+		for(size_t i = 0; i < n; i += detail::BatchSize) {
+			blk.n = std::min(detail::BatchSize, n - i);
+			detail::loadBlock(luv, n, i, Layout::Interleaved, blk);
+			if(luv2rgb8(blk, rgb + stride * i, alpha, gam)) clamped = true;
+		}
+		return clamped;
+	}
+
+	template <typename T>
+	bool Profile<T>::luv2rgb8(detail::Block<T>& blk, uint8_t * const rgb, const bool alpha, const Gamma gam) const {
+		if(lut) {
+			const bool clamped = lut->interpolate(blk);
+			detail::quantizeBlock(blk, rgb, alpha);//round straight to bytes
+			return clamped;
+		}
+		linBlock(blk);//Luv -> linear rgb
+		for(size_t k = 0; k < 3; k++) trc.encode(blk.c[k], blk.n, gam);//gamma correction
+		return detail::quantizeBlock(blk, rgb, alpha);//clamp and round straight to bytes
+	}
+
+	//@brief      : integer only fused Luv -> 8 bit rgb (see declaration for parameters)
+	template <typename T>
+	bool Profile<T>::luv2rgb8(const detail::Block<int32_t>& blk, uint8_t * const rgb, const bool alpha) const {
+		static const int64_t d = (int64_t)std::llround(std::ldexp(27.0 / 24389, 32));//(3/29)^3 in Q32
+		const int64_t sMax = int64_t(1) << 32;//Y / vp < 1 for any real color, bounding it keeps the products below in 64 bits
+		const size_t stride = alpha ? 4 : 3;
+		bool clamped = false;
+		for(size_t j = 0; j < blk.n; j++) {
+			const int64_t L  = blk.c[0][j], u = blk.c[1][j], v = blk.c[2][j];
+			const int64_t Lp = (L + (16 << 16)) / 116;//Q16
+			const int64_t Y  = L <= 0 ? 0 : L <= (8 << 16) ? (L * d) >> 24 : (Lp * Lp * Lp) >> 24;//Q24 (Q16 leaves only a few steps for the darkest colors, spline round off can push black slightly below 0)
+			const int64_t vp = std::max<int64_t>((L * vLFix + v * vvFix) >> 16, 1);//Q16
+			const int64_t s  = std::min<int64_t>((Y << 24) / vp, sMax);//Q32 (0 for L* = 0 since Y = 0)
+			uint8_t * const p = rgb + stride * j;
+			for(size_t k = 0; k < 3; k++) {
+				int64_t lin = (((L * luvFix[3*k] + u * luvFix[3*k+1] + v * luvFix[3*k+2]) >> 24) * s) >> 26;//Q18 product then linear rgb in Q24 (Q16 alone is ~1.7 codes per step at black for gamma 2.2)
+				if(lin < 0 || lin > (1 << 24)) {
+					clamped = true;
+					lin = lin < 0 ? 0 : (1 << 24);
+				}
+				//look up the octave of x = lin + 2^FixLow by normalizing it into [2^24, 2^25) then interpolate within the octave
+				int32_t x = (int32_t)lin + (1 << FixLow);
+				const int32_t s = x < (1 << FixOct) ? FixOct : 0;//x >> FixOct is 0 for the darkest values
+				const int32_t n = s + octFix[(x << s) >> FixOct];
+				x <<= n;
+				const int32_t i = ((24 - FixLow - n) << FixMant) + (x >> (24 - FixMant)) - (1 << FixMant);
+				const int32_t f = (x >> (12 - FixMant)) & ((1 << 12) - 1);//12 bit fraction of the interval
+				p[k] = (uint8_t)((((int32_t)encFix[i] << 12) + ((int32_t)encFix[i+1] - encFix[i]) * f + (1 << 19)) >> 20);//interpolate and round
+			}
+			if(alpha) p[3] = 0xFF;
+		}
+		return clamped;
+	}
+
+	//@brief  : get a copy of this profile that converts Luv -> rgb with a precomputed lattice
+	//@param n: number of lattice points along each Luv axis
+	//@return : profile using the lattice for luv2rgb and luv2rgb8
+	template <typename T>
+	Profile<T> Profile<T>::withLattice(const size_t n) const {
+		Profile p(*this);
+		p.lut.reset();//make sure the lattice is sampled from the exact conversion
+		p.lut = std::make_shared<const detail::Lattice<T> >(p, n);
+		return p;
+	}
+
+	//@brief : get the largest color difference introduced by the lattice
+	//@return: estimated max Delta E*uv for in gamut colors (0 without a lattice)
+	template <typename T>
+	T Profile<T>::latticeError() const {return lut ? lut->maxDeltaE() : T(0);}
+
+	//@brief    : block version of luv2lin
+	//@param blk: block of Luv values to convert to linear rgb in place
+	template <typename T>
+	void Profile<T>::linBlock(detail::Block<T>& blk) const {
+		static const T d = T(27) / 24389;//(3/29)^3
+		T * const c0 = blk.c[0];
+		T * const c1 = blk.c[1];
+		T * const c2 = blk.c[2];
+		const std::array<T, 9> m = luvMat;//copy to local so the compiler knows it isn't aliased
+		const T vl = vL, vu = vv;
+		for(size_t j = 0; j < blk.n; j++) {
+			const T L  = c0[j], u = c1[j], v = c2[j];
+			const T Lp = (L + 16) / 116;
+			const T Y  = L <= 8 ? L * d : Lp * Lp * Lp;
+			const T vp = L * vl + v * vu;
+			const T s  = T(0) == L ? T(0) : Y / vp;//handle L* = 0
+			c0[j] = (L * m[0] + u * m[1] + v * m[2]) * s;
+			c1[j] = (L * m[3] + u * m[4] + v * m[5]) * s;
+			c2[j] = (L * m[6] + u * m[7] + v * m[8]) * s;
+		}
+	}
 }
 
 #endif//_COLORSPACE_H_
\ No newline at end of file
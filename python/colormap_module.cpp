@@ -34,18 +34,26 @@
 //method table
 static PyMethodDef methodDef[] = {//{function name in python module, function pointer, argument types, description}
 	//color map functions
-	{ramp_name         .c_str(), (PyCFunction) ramp_wrapper         , METH_VARARGS | METH_KEYWORDS, ramp_help         .c_str()},
-	{cyclic_name       .c_str(), (PyCFunction) cyclic_wrapper       , METH_VARARGS | METH_KEYWORDS, cyclic_help       .c_str()},
-	{disk_name         .c_str(), (PyCFunction) disk_wrapper         , METH_VARARGS | METH_KEYWORDS, disk_help         .c_str()},
-	{sphere_name       .c_str(), (PyCFunction) sphere_wrapper       , METH_VARARGS | METH_KEYWORDS, sphere_help       .c_str()},
-	{ball_name         .c_str(), (PyCFunction) ball_wrapper         , METH_VARARGS | METH_KEYWORDS, ball_help         .c_str()},
+	{ramp_name           .c_str(), (PyCFunction) ramp_wrapper           , METH_VARARGS | METH_KEYWORDS, ramp_help           .c_str()},
+	{cyclic_name         .c_str(), (PyCFunction) cyclic_wrapper         , METH_VARARGS | METH_KEYWORDS, cyclic_help         .c_str()},
+	{disk_name           .c_str(), (PyCFunction) disk_wrapper           , METH_VARARGS | METH_KEYWORDS, disk_help           .c_str()},
+	{sphere_name         .c_str(), (PyCFunction) sphere_wrapper         , METH_VARARGS | METH_KEYWORDS, sphere_help         .c_str()},
+	{ball_name           .c_str(), (PyCFunction) ball_wrapper           , METH_VARARGS | METH_KEYWORDS, ball_help           .c_str()},
 
 	//legend functions
-	{cyclic_legend_name.c_str(), (PyCFunction) cyclic_legend_wrapper, METH_VARARGS | METH_KEYWORDS, cyclic_legend_help.c_str()},
-	{ramp_legend_name  .c_str(), (PyCFunction) ramp_legend_wrapper  , METH_VARARGS | METH_KEYWORDS, ramp_legend_help  .c_str()},
-	{disk_legend_name  .c_str(), (PyCFunction) disk_legend_wrapper  , METH_VARARGS | METH_KEYWORDS, disk_legend_help  .c_str()},
-	{sphere_legend_name.c_str(), (PyCFunction) sphere_legend_wrapper, METH_VARARGS | METH_KEYWORDS, sphere_legend_help.c_str()},
-	{ball_legend_name  .c_str(), (PyCFunction) ball_legend_wrapper  , METH_VARARGS | METH_KEYWORDS, ball_legend_help  .c_str()},
+	{cyclic_legend_name  .c_str(), (PyCFunction) cyclic_legend_wrapper  , METH_VARARGS | METH_KEYWORDS, cyclic_legend_help  .c_str()},
+	{ramp_legend_name    .c_str(), (PyCFunction) ramp_legend_wrapper    , METH_VARARGS | METH_KEYWORDS, ramp_legend_help    .c_str()},
+	{disk_legend_name    .c_str(), (PyCFunction) disk_legend_wrapper    , METH_VARARGS | METH_KEYWORDS, disk_legend_help    .c_str()},
+	{sphere_legend_name  .c_str(), (PyCFunction) sphere_legend_wrapper  , METH_VARARGS | METH_KEYWORDS, sphere_legend_help  .c_str()},
+	{ball_legend_name    .c_str(), (PyCFunction) ball_legend_wrapper    , METH_VARARGS | METH_KEYWORDS, ball_legend_help    .c_str()},
+
+	//color space conversion functions
+	{rgb2luv_name        .c_str(), (PyCFunction) rgb2luv_wrapper        , METH_VARARGS | METH_KEYWORDS, rgb2luv_help        .c_str()},
+	{rgb2lab_name        .c_str(), (PyCFunction) rgb2lab_wrapper        , METH_VARARGS | METH_KEYWORDS, rgb2lab_help        .c_str()},
+
+	//run time color map creation
+	{register_name       .c_str(), (PyCFunction) register_wrapper       , METH_VARARGS | METH_KEYWORDS, register_help       .c_str()},
+	{register_bicone_name.c_str(), (PyCFunction) register_bicone_wrapper, METH_VARARGS | METH_KEYWORDS, register_bicone_help.c_str()},
 	{NULL, NULL, 0, NULL}//sentinel
 };
 
@@ -42,6 +42,10 @@
 #include <sstream>
 #include <algorithm>
 #include <cctype>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
 
 //@brief: python bindings for perceptually uniform color map functions defined in colormap.hpp
 
@@ -51,7 +55,13 @@ std::string rampDescriptions(std::string prefix) {
 	     + prefix + "-'fire' : black -> puruple -> magenta -> yellow -> white\n"
 	     + prefix + "-'ocean': black -> blue -> green -> yellow -> white\n"
 	     + prefix + "-'ice'  : black -> purple -> blue -> cyan -> white\n"
-	     + prefix + "-'div'  : blue -> white -> red\n";
+	     + prefix + "-'div'  : blue -> white -> red\n"
+	     + prefix + "-CET maps (https://colorcet.com/gallery.html) interpolated from 256 entry tables:\n"
+	     + prefix + "  -'L01' ... 'L20'        : linear\n"
+	     + prefix + "  -'D01' ... 'D13', 'D01A': diverging (there is no D05)\n"
+	     + prefix + "  -'R1'  ... 'R4'         : rainbow\n"
+	     + prefix + "  -'I1'  ... 'I3'         : isoluminant\n"
+	     + prefix + "  -'CBL1', 'CBL2', 'CBD1' : color blind safe linear and diverging\n";
 }
 
 //names and descriptions of available cyclic color maps, these need to match the options defined in 'getCyclic'
@@ -59,7 +69,10 @@ std::string cyclicDescriptions(std::string prefix) {
 	return prefix + "-'gray': black -> white -> black\n"
 	     + prefix + "-'four': red -> blue -> green -> yellow -> red\n"
 	     + prefix + "-'six' : red -> magenta -> blue -> teal -> green -> yellow -> red\n"
-	     + prefix + "-'div' : blue -> gray -> red -> blue\n";
+	     + prefix + "-'div' : blue -> gray -> red -> blue\n"
+	     + prefix + "-CET maps (https://colorcet.com/gallery.html) interpolated from 256 entry tables:\n"
+	     + prefix + "  -'C1' ... 'C7'  : cyclic\n"
+	     + prefix + "  -'CBC1', 'CBC2' : color blind safe cyclic\n";
 }
 
 //names and descriptions of available disk color maps, these need to match the options defined in 'getDisk'
@@ -70,6 +83,16 @@ std::string diskDescriptions(std::string prefix) {
 std::string sphereDescriptions(std::string prefix) {return diskDescriptions(prefix);}
 std::string ballDescriptions(std::string prefix) {return diskDescriptions(prefix);}
 
+//names and descriptions of available output color spaces, these need to match the options defined in 'getGamut'
+std::string gamutDescriptions(std::string prefix) {
+	return prefix + "-'srgb' : sRGB (D65)\n"
+	     + prefix + "-'adobe': Adobe RGB 1998 (D65)\n"
+	     + prefix + "-'apple': Apple RGB (D65)\n"
+	     + prefix + "-'pal'  : PAL / SECAM RGB (D65)\n"
+	     + prefix + "-'ntsc' : NTSC / SMPTE C RGB (D65)\n"
+	     + prefix + "-'cie'  : CIE 1931 RGB (E)\n";
+}
+
 //name of module
 const std::string module_name = "colormap";//make sure this matches the signature of the PyMODINIT_FUNC
 
@@ -85,6 +108,10 @@ const std::string cyclic_legend_name = cyclic_name + legend_suffix;//cyclic lege
 const std::string disk_legend_name   = disk_name   + legend_suffix;//disk legend function
 const std::string sphere_legend_name = sphere_name + legend_suffix;//sphere legend function
 const std::string ball_legend_name   = ball_name   + legend_suffix;//ball legend function
+const std::string rgb2luv_name  = "rgb2luv";//sRGB -> Luv conversion function
+const std::string rgb2lab_name  = "rgb2lab";//sRGB -> Lab conversion function
+const std::string register_name = "register";//run time color map registration function
+const std::string register_bicone_name = register_name + "_bicone";//run time bicone registration function
 
 const std::string module_help = "\
 perceptually uniform color maps based on:\n\
@@ -97,7 +124,10 @@ The following color maps are available:\n\
   *disk   (via " + module_name + "." + disk_name + "):\n" + diskDescriptions("    ") + "\
   *sphere (via " + module_name + ".sphere):\n\
   *ball   (via " + module_name + ".ball):\n\
-Legend generation functions are also available via " + module_name + ".type" + legend_suffix + "() functions";
+Legend generation functions are also available via " + module_name + ".type" + legend_suffix + "() functions\n\
+Colored images can be converted back to cie spaces via " + module_name + "." + rgb2luv_name + "() and " + module_name + "." + rgb2lab_name + "()\n\
+Additional linear and cyclic maps can be built from Luv control points via " + module_name + "." + register_name + "()\n\
+Additional disk, sphere, and ball maps can be built from Luv equator colors via " + module_name + "." + register_bicone_name + "()";
 ////////////////////////////////////////////////////////////////
 //            Python Wrapper for Linear Colormaps             //
 ////////////////////////////////////////////////////////////////
@@ -112,19 +142,25 @@ Legend generation functions are also available via " + module_name + ".type" + l
 //             @keyword scale  : [optional] flag to rescale values to [0,1] before coloring
 //             @keyword alpha  : [optional] true / false to include an alpha channel
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
+//             @keyword uniform: [optional] true / false to map values through the inverse arc length of the map
+//             @keyword exact  : [optional] true / false to evaluate the map for every value / interpolate a cached 4096 entry table
 static PyObject* ramp_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
 
 //python help string for ramp_wrapper
 const std::string ramp_help = "\
 @brief        : map an array of scalars to an array of rgb values with a linear colormap\n\
-@param scalars: scalar values to compute map of\n\
+@param scalars: scalar values to compute map of (uint8 and uint16 arrays are colored from a table with an entry per value)\n\
 @param map    : name of color map to use\n" + rampDescriptions("                ") + "\
 @param fill   : fill value for scalars falling outside of [0,1] and NANs (all 3/4 channels are filled with the same value)\n\
 @param scale  : True/False to rescale input to [0,1] before coloring\n\
 @param alpha  : True/False to include alpha channel (rgba/rgb)\n\
 @param float  : True/False to return colors as 64 bit floats [0,1] or 8 bit uints [0,255]\n\
+@param gamut  : rgb color space to return colors in\n" + gamutDescriptions("                ") + "\
+@param uniform: True/False to treat scalars as fractional color distance (uniform steps in Delta E*uv through an inverse arc length table built on first use for each map)\n\
+@param exact  : True/False to evaluate the map for every scalar or interpolate a cached 4096 entry table (differences are far below a just noticeable difference)\n\
 @return       : array of rgb(a) values\n"
- + module_name + '.' + ramp_name + "(scalars, map = 'fire', fill = 0, scale = False, alpha = False, float = False)";
+ + module_name + '.' + ramp_name + "(scalars, map = 'fire', fill = 0, scale = False, alpha = False, float = False, gamut = 'srgb', uniform = False, exact = False)";
 
 ////////////////////////////////////////////////////////////////
 //            Python Wrapper for Cyclic Colormaps             //
@@ -140,19 +176,25 @@ const std::string ramp_help = "\
 //             @keyword scale  : [optional] flag to rescale values to [0,1] before coloring
 //             @keyword alpha  : [optional] true / false to include an alpha channel
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
+//             @keyword uniform: [optional] true / false to map values through the inverse arc length of the map
+//             @keyword exact  : [optional] true / false to evaluate the map for every value / interpolate a cached 4096 entry table
 static PyObject* cyclic_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
 
 //python help string for cyclic_wrapper
 const std::string cyclic_help = "\
 @brief        : map an array of scalars to an array of rgb values with a periodic colormap\n\
-@param scalars: scalar values to compute map of\n\
+@param scalars: scalar values to compute map of (uint8 and uint16 arrays are colored from a table with an entry per value)\n\
 @param map    : name of color map to use\n" + cyclicDescriptions("                ") + "\
 @param fill   : fill value for scalars falling outside of [0,1] and NANs (all 3/4 channels are filled with the same value)\n\
 @param scale  : True/False to rescale input to [0,1] before coloring\n\
 @param alpha  : True/False to include alpha channel (rgba/rgb)\n\
 @param float  : True/False to return colors as 64 bit floats [0,1] or 8 bit uints [0,255]\n\
+@param gamut  : rgb color space to return colors in\n" + gamutDescriptions("                ") + "\
+@param uniform: True/False to treat scalars as fractional color distance (uniform steps in Delta E*uv through an inverse arc length table built on first use for each map)\n\
+@param exact  : True/False to evaluate the map for every scalar or interpolate a cached 4096 entry table (differences are far below a just noticeable difference)\n\
 @return       : array of rgb(a) values\n"
- + module_name + '.' + cyclic_name + "(scalars, map = 'four', fill = 0, scale = False, alpha = False, float = False)";
+ + module_name + '.' + cyclic_name + "(scalars, map = 'four', fill = 0, scale = False, alpha = False, float = False, gamut = 'srgb', uniform = False, exact = False)";
 
 ////////////////////////////////////////////////////////////////
 //             Python Wrapper for Disk Colormaps              //
@@ -171,6 +213,8 @@ const std::string cyclic_help = "\
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen  : true/false white/black center
 //             @keyword sym    : type of inversion symmetry to apply
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
+//             @keyword exact  : [optional] true / false to evaluate the map for every pair / interpolate a cached polar table (default true)
 static PyObject* disk_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
 
 //python help string for disk_wrapper
@@ -188,8 +232,10 @@ const std::string disk_help = "\
                -None: no inversion symmetry\n\
                -'a' : double azimuthal angle (fewer degenerate colors but perceptual flat spot at equator)\n\
                -'p' : double polar angle (equator is degenerate but no perceptual flat spot)\n\
+@param gamut : rgb color space to return colors in\n" + gamutDescriptions("               ") + "\
+@param exact : True/False to evaluate the map for every pair or interpolate a cached polar table (faster, at most 0.07 Delta E*uv from the exact colors)\n\
 @return      : array of rgb(a) values\n"
- + module_name + '.' + disk_name + "(radii, angles, map = 'four', fill = 0, scale = False, alpha = False, float = False, w_cen = False, sym = None)";
+ + module_name + '.' + disk_name + "(radii, angles, map = 'four', fill = 0, scale = False, alpha = False, float = False, w_cen = False, sym = None, gamut = 'srgb', exact = True)";
 
 ////////////////////////////////////////////////////////////////
 //            Python Wrapper for Sphere Colormaps             //
@@ -208,6 +254,8 @@ const std::string disk_help = "\
 //             @keyword float   : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen   : true/false white/black center
 //             @keyword sym     : type of inversion symmetry to apply
+//             @keyword gamut   : [optional] name of rgb color space to return colors in
+//             @keyword exact   : [optional] true / false to evaluate the map for every pair / interpolate a cached cube map (default true)
 static PyObject* sphere_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
 
 //python help string for sphere_wrapper
@@ -225,8 +273,10 @@ const std::string sphere_help = "\
                  -None: no inversion symmetry\n\
                  -'a' : double azimuthal angle (fewer degenerate colors but perceptual flat spot at equator)\n\
                  -'p' : double polar angle (equator is degenerate but no perceptual flat spot)\n\
+@param gamut   : rgb color space to return colors in\n" + gamutDescriptions("                 ") + "\
+@param exact   : True/False to evaluate the map for every pair or interpolate a cached cube map (faster, at most 0.7 Delta E*uv from the exact colors)\n\
 @return        : array of rgb(a) values\n"
- + module_name + '.' + sphere_name + "(azimuths, polars, map = 'four', fill = 0, scale = False, alpha = False, float = False, w_cen = False, sym = None)";
+ + module_name + '.' + sphere_name + "(azimuths, polars, map = 'four', fill = 0, scale = False, alpha = False, float = False, w_cen = False, sym = None, gamut = 'srgb', exact = True)";
 
 ////////////////////////////////////////////////////////////////
 //             Python Wrapper for Ball Colormaps              //
@@ -246,6 +296,8 @@ const std::string sphere_help = "\
 //             @keyword float   : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen   : true/false white/black center
 //             @keyword sym     : type of inversion symmetry to apply
+//             @keyword gamut   : [optional] name of rgb color space to return colors in
+//             @keyword exact   : [optional] true / false to evaluate the map for every triplet / interpolate a cached voxel table (default true)
 static PyObject* ball_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
 
 //python help string for ball_wrapper
@@ -265,8 +317,10 @@ const std::string ball_help = "\
                  -None: no inversion symmetry\n\
                  -'a' : double azimuthal angle (fewer degenerate colors but perceptual flat spot at equator)\n\
                  -'p' : double polar angle (equator is degenerate but no perceptual flat spot)\n\
+@param gamut   : rgb color space to return colors in\n" + gamutDescriptions("                 ") + "\
+@param exact   : True/False to evaluate the map for every triplet or interpolate a cached voxel table (faster after a 7 MB table is baked, at most 0.5 Delta E*uv from the exact colors)\n\
 @return        : array of rgb(a) values\n"
- + module_name + '.' + ball_name + "(radii, azimuths, polars, map = 'four', fill = 0, scale = False, alpha = False, float = False, w_cen = False, sym = None)";
+ + module_name + '.' + ball_name + "(radii, azimuths, polars, map = 'four', fill = 0, scale = False, alpha = False, float = False, w_cen = False, sym = None, gamut = 'srgb', exact = True)";
 
 ////////////////////////////////////////////////////////////////
 //              Python Wrapper for Ramp Legends               //
@@ -443,6 +497,88 @@ const std::string ball_legend_help = "\
 @return        : 3D rgb (solid background) or rgba (transparent background) array of legend image\n"
  + module_name + '.' + ball_legend_name + "(map, width = 512, fill = 0, ripple_p = 0, ripple_a = 0, alpha = False, float = False, w_cen = False, sym = None)";
 
+////////////////////////////////////////////////////////////////
+//         Python Wrapper for Color Space Conversion          //
+////////////////////////////////////////////////////////////////
+
+//@brief wrapper function for sRGB -> Luv conversion
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword rgb: array of sRGB(A) colors to convert
+static PyObject* rgb2luv_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
+
+//python help string for rgb2luv_wrapper
+const std::string rgb2luv_help = "\
+@brief    : convert an array of sRGB colors to CIELUV (D65)\n\
+@param rgb: sRGB(A) colors to convert with 3 or 4 values in the last dimension (alpha is ignored)\n\
+            -uint8 : [0,255] (fast path through a 256 entry linearization table)\n\
+            -uint16: [0,65535] (fast path through a 65536 entry linearization table)\n\
+            -other : [0,1] (converted to 64 bit floats)\n\
+@return   : array of Luv values as 64 bit floats with the same shape as rgb (except for 3 values in the last dimension)\n"
+ + module_name + '.' + rgb2luv_name + "(rgb)";
+
+//@brief wrapper function for sRGB -> Lab conversion
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword rgb: array of sRGB(A) colors to convert
+static PyObject* rgb2lab_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
+
+//python help string for rgb2lab_wrapper
+const std::string rgb2lab_help = "\
+@brief    : convert an array of sRGB colors to CIELAB (D65)\n\
+@param rgb: sRGB(A) colors to convert with 3 or 4 values in the last dimension (alpha is ignored)\n\
+            -uint8 : [0,255] (fast path through a 256 entry linearization table)\n\
+            -uint16: [0,65535] (fast path through a 65536 entry linearization table)\n\
+            -other : [0,1] (converted to 64 bit floats)\n\
+@return   : array of Lab values as 64 bit floats with the same shape as rgb (except for 3 values in the last dimension)\n"
+ + module_name + '.' + rgb2lab_name + "(rgb)";
+
+////////////////////////////////////////////////////////////////
+//        Python Wrapper for Run Time Color Map Creation      //
+////////////////////////////////////////////////////////////////
+
+//@brief wrapper function to register a ramp or cyclic color map built from Luv control points
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword name  : name to register map under
+//             @keyword luv   : n x 3 array of Luv control points
+//             @keyword cyclic: [optional] true / false to register a cyclic / ramp map
+static PyObject* register_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
+
+//python help string for register_wrapper
+const std::string register_help = "\
+@brief       : build a perceptually uniform color map from Luv control points and make it available by name\n\
+@param name  : name to register map under (can't be the name of a predefined map, registering an existing name replaces it)\n\
+@param luv   : n x 3 array of Luv control points (at least 2) for a cubic uniform b-spline\n\
+               -ramp  : the spline is padded to start and end at the first and last point\n\
+               -cyclic: the spline is closed to loop back to the first point\n\
+@param cyclic: True/False to register a map for " + module_name + '.' + cyclic_name + " / " + module_name + '.' + ramp_name + "\n\
+               registered maps accept all keywords of the predefined maps (legends are only available for predefined maps)\n"
+ + module_name + '.' + register_name + "(name, luv, cyclic = False)";
+
+//@brief wrapper function to register a disk, sphere, and ball color map built from Luv equator colors
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword name   : name to register map under
+//             @keyword corners: n x 3 array of Luv equator colors
+//             @keyword l0     : [optional] L* of the bottom pole
+//             @keyword l1     : [optional] L* of the top pole
+static PyObject* register_bicone_wrapper(PyObject* self, PyObject* args, PyObject* kwds);
+
+//python help string for register_bicone_wrapper
+const std::string register_bicone_help = "\
+@brief        : build a perceptually uniform bicone from Luv equator colors and make it available by name for the disk, sphere, and ball maps\n\
+@param name   : name to register map under (can't be the name of a predefined map, registering an existing name replaces it)\n\
+@param corners: n x 3 array of Luv colors (at least 2) equally spaced around the equator, e.g. 3 or 12 for 3 or 12 fold symmetry\n\
+@param l0     : L* of the bottom (black) pole, must be below the equator lightness\n\
+@param l1     : L* of the top (white) pole, must be above the equator lightness\n\
+                registered maps accept all keywords of the predefined maps (legends are only available for predefined maps)\n"
+ + module_name + '.' + register_bicone_name + "(name, corners, l0 = 12, l1 = 98)";
+
 ////////////////////////////////////////////////////////////////
 //                      Helper Functions                      //
 ////////////////////////////////////////////////////////////////
@@ -460,32 +596,90 @@ std::string cleanString(const char* cStr) {
 //@brief: convert from name to ramp function
 //@param cName: name of ramp function to get function for
 //@return: ramp function matching name (or NULL if a match wasn't found)
-colormap::ramp::func<double> getRamp(const char* cName) {
+//@note  : templated on function type so the same names select the sRGB (func), profile (pfunc), or 8 bit (func8) overloads
+template <typename F = colormap::ramp::func<double> >
+F getRamp(const char* cName) {
 	const std::string name = cleanString(cName);
 	if     (0 == name.compare("gray" )) return colormap::ramp::gray <double>;
 	else if(0 == name.compare("fire" )) return colormap::ramp::fire <double>;
 	else if(0 == name.compare("ocean")) return colormap::ramp::ocean<double>;
 	else if(0 == name.compare("ice"  )) return colormap::ramp::ice  <double>;
 	else if(0 == name.compare("div"  )) return colormap::ramp::div  <double>;
+	else if(0 == name.compare("l01"  )) return colormap::ramp::cet<double, CET::L01 >;
+	else if(0 == name.compare("l02"  )) return colormap::ramp::cet<double, CET::L02 >;
+	else if(0 == name.compare("l03"  )) return colormap::ramp::cet<double, CET::L03 >;
+	else if(0 == name.compare("l04"  )) return colormap::ramp::cet<double, CET::L04 >;
+	else if(0 == name.compare("l05"  )) return colormap::ramp::cet<double, CET::L05 >;
+	else if(0 == name.compare("l06"  )) return colormap::ramp::cet<double, CET::L06 >;
+	else if(0 == name.compare("l07"  )) return colormap::ramp::cet<double, CET::L07 >;
+	else if(0 == name.compare("l08"  )) return colormap::ramp::cet<double, CET::L08 >;
+	else if(0 == name.compare("l09"  )) return colormap::ramp::cet<double, CET::L09 >;
+	else if(0 == name.compare("l10"  )) return colormap::ramp::cet<double, CET::L10 >;
+	else if(0 == name.compare("l11"  )) return colormap::ramp::cet<double, CET::L11 >;
+	else if(0 == name.compare("l12"  )) return colormap::ramp::cet<double, CET::L12 >;
+	else if(0 == name.compare("l13"  )) return colormap::ramp::cet<double, CET::L13 >;
+	else if(0 == name.compare("l14"  )) return colormap::ramp::cet<double, CET::L14 >;
+	else if(0 == name.compare("l15"  )) return colormap::ramp::cet<double, CET::L15 >;
+	else if(0 == name.compare("l16"  )) return colormap::ramp::cet<double, CET::L16 >;
+	else if(0 == name.compare("l17"  )) return colormap::ramp::cet<double, CET::L17 >;
+	else if(0 == name.compare("l18"  )) return colormap::ramp::cet<double, CET::L18 >;
+	else if(0 == name.compare("l19"  )) return colormap::ramp::cet<double, CET::L19 >;
+	else if(0 == name.compare("l20"  )) return colormap::ramp::cet<double, CET::L20 >;
+	else if(0 == name.compare("d01"  )) return colormap::ramp::cet<double, CET::D01 >;
+	else if(0 == name.compare("d01a" )) return colormap::ramp::cet<double, CET::D01A>;
+	else if(0 == name.compare("d02"  )) return colormap::ramp::cet<double, CET::D02 >;
+	else if(0 == name.compare("d03"  )) return colormap::ramp::cet<double, CET::D03 >;
+	else if(0 == name.compare("d04"  )) return colormap::ramp::cet<double, CET::D04 >;
+	else if(0 == name.compare("d06"  )) return colormap::ramp::cet<double, CET::D06 >;
+	else if(0 == name.compare("d07"  )) return colormap::ramp::cet<double, CET::D07 >;
+	else if(0 == name.compare("d08"  )) return colormap::ramp::cet<double, CET::D08 >;
+	else if(0 == name.compare("d09"  )) return colormap::ramp::cet<double, CET::D09 >;
+	else if(0 == name.compare("d10"  )) return colormap::ramp::cet<double, CET::D10 >;
+	else if(0 == name.compare("d11"  )) return colormap::ramp::cet<double, CET::D11 >;
+	else if(0 == name.compare("d12"  )) return colormap::ramp::cet<double, CET::D12 >;
+	else if(0 == name.compare("d13"  )) return colormap::ramp::cet<double, CET::D13 >;
+	else if(0 == name.compare("r1"   )) return colormap::ramp::cet<double, CET::R1  >;
+	else if(0 == name.compare("r2"   )) return colormap::ramp::cet<double, CET::R2  >;
+	else if(0 == name.compare("r3"   )) return colormap::ramp::cet<double, CET::R3  >;
+	else if(0 == name.compare("r4"   )) return colormap::ramp::cet<double, CET::R4  >;
+	else if(0 == name.compare("i1"   )) return colormap::ramp::cet<double, CET::I1  >;
+	else if(0 == name.compare("i2"   )) return colormap::ramp::cet<double, CET::I2  >;
+	else if(0 == name.compare("i3"   )) return colormap::ramp::cet<double, CET::I3  >;
+	else if(0 == name.compare("cbl1" )) return colormap::ramp::cet<double, CET::CBL1>;
+	else if(0 == name.compare("cbl2" )) return colormap::ramp::cet<double, CET::CBL2>;
+	else if(0 == name.compare("cbd1" )) return colormap::ramp::cet<double, CET::CBD1>;
 	return NULL;
 }
 
 //@brief: convert from name to cyclic function
 //@param cName: name of ramp function to get function for
 //@return: ramp function matching name (or NULL if a match wasn't found)
-colormap::cyclic::func<double> getCyclic(const char* cName) {
+//@note  : templated on function type so the same names select the sRGB (func), profile (pfunc), or 8 bit (func8) overloads
+template <typename F = colormap::cyclic::func<double> >
+F getCyclic(const char* cName) {
 	const std::string name = cleanString(cName);
 	if     (0 == name.compare("gray" )) return colormap::cyclic::gray<double>;
 	else if(0 == name.compare("four" )) return colormap::cyclic::four<double>;
 	else if(0 == name.compare("six"  )) return colormap::cyclic::six <double>;
 	else if(0 == name.compare("div"  )) return colormap::cyclic::div <double>;
+	else if(0 == name.compare("c1"   )) return colormap::cyclic::cet<double, CET::C1  >;
+	else if(0 == name.compare("c2"   )) return colormap::cyclic::cet<double, CET::C2  >;
+	else if(0 == name.compare("c3"   )) return colormap::cyclic::cet<double, CET::C3  >;
+	else if(0 == name.compare("c4"   )) return colormap::cyclic::cet<double, CET::C4  >;
+	else if(0 == name.compare("c5"   )) return colormap::cyclic::cet<double, CET::C5  >;
+	else if(0 == name.compare("c6"   )) return colormap::cyclic::cet<double, CET::C6  >;
+	else if(0 == name.compare("c7"   )) return colormap::cyclic::cet<double, CET::C7  >;
+	else if(0 == name.compare("cbc1" )) return colormap::cyclic::cet<double, CET::CBC1>;
+	else if(0 == name.compare("cbc2" )) return colormap::cyclic::cet<double, CET::CBC2>;
 	return NULL;
 }
 
 //@brief: convert from name to disk function
 //@param cName: name of ramp function to get function for
 //@return: ramp function matching name (or NULL if a match wasn't found)
-colormap::disk::func<double> getDisk(const char* cName) {
+//@note  : templated on function type so the same names select the sRGB (func), profile (pfunc), or 8 bit (func8) overloads
+template <typename F = colormap::disk::func<double> >
+F getDisk(const char* cName) {
 	const std::string name = cleanString(cName);
 	if     (0 == name.compare("four")) return colormap::disk::four<double>;
 	else if(0 == name.compare("six" )) return colormap::disk::six <double>;
@@ -495,7 +689,9 @@ colormap::disk::func<double> getDisk(const char* cName) {
 //@brief: convert from name to sphere function
 //@param cName: name of ramp function to get function for
 //@return: ramp function matching name (or NULL if a match wasn't found)
-colormap::sphere::func<double> getSphere(const char* cName) {
+//@note  : templated on function type so the same names select the sRGB (func), profile (pfunc), or 8 bit (func8) overloads
+template <typename F = colormap::sphere::func<double> >
+F getSphere(const char* cName) {
 	const std::string name = cleanString(cName);
 	if     (0 == name.compare("four")) return colormap::sphere::four<double>;
 	else if(0 == name.compare("six" )) return colormap::sphere::six <double>;
@@ -505,13 +701,70 @@ colormap::sphere::func<double> getSphere(const char* cName) {
 //@brief: convert from name to ball function
 //@param cName: name of ramp function to get function for
 //@return: ramp function matching name (or NULL if a match wasn't found)
-colormap::ball::func<double> getBall(const char* cName) {
+//@note  : templated on function type so the same names select the sRGB (func), profile (pfunc), or 8 bit (func8) overloads
+template <typename F = colormap::ball::func<double> >
+F getBall(const char* cName) {
 	const std::string name = cleanString(cName);
 	if     (0 == name.compare("four")) return colormap::ball::four<double>;
 	else if(0 == name.compare("six" )) return colormap::ball::six <double>;
 	return NULL;
 }
 
+//@brief: ramp or cyclic color map registered from python at run time
+struct CustomMap {
+	//@brief    : construct a registered map
+	//@param lut: spline color map
+	CustomMap(colormap::DynamicLut<double>&& l) : lut(std::move(l)) {}
+
+	//@brief     : get the baked table for a gamut (built on first use)
+	//@param prof: rgb color space of table
+	//@return    : baked table
+	const colormap::BakedLut<double>& baked(const color::Profile<double>& prof) {
+		for(const auto& t : tables) if(t.first == &prof) return *t.second;
+		tables.emplace_back(&prof, std::unique_ptr<const colormap::BakedLut<double> >(new colormap::BakedLut<double>(lut, colormap::BakedLut<double>::DefaultSize, prof)));
+		return *tables.back().second;
+	}
+
+	colormap::DynamicLut<double> lut;//spline color map
+	std::vector<std::pair<color::Profile<double> const *, std::unique_ptr<const colormap::BakedLut<double> > > > tables;//baked tables for each gamut used so far (gamuts are static)
+};
+
+//@brief       : get the registered color maps of a type (python calls are serialized by the GIL)
+//@param cyclic: true/false for cyclic/ramp maps
+//@return      : cleaned name -> map
+std::map<std::string, std::unique_ptr<CustomMap> >& customMaps(const bool cyclic) {
+	static std::map<std::string, std::unique_ptr<CustomMap> > ramps, cycles;
+	return cyclic ? cycles : ramps;
+}
+
+//@brief       : convert from name to registered color map
+//@param cName : name of color map to get
+//@param cyclic: true/false to search cyclic/ramp maps
+//@return      : registered map matching name (or NULL if a match wasn't found)
+CustomMap* getCustom(const char* cName, const bool cyclic) {
+	std::map<std::string, std::unique_ptr<CustomMap> >& maps = customMaps(cyclic);
+	const auto iter = maps.find(cleanString(cName));
+	return maps.end() == iter ? NULL : iter->second.get();
+}
+
+//@brief            : build a color map handle from a registry by name
+//@param reg        : registry to build map from
+//@param cName      : name of map to build (or NULL to use the default)
+//@param defaultName: name of map to fall back to
+//@param opts       : settings to bind into the handle
+//@return           : handle (the default map with a warning if the name wasn't found)
+template <size_t D>
+std::unique_ptr<const colormap::Colormap<double, D> > getHandle(const colormap::Registry<double, D>& reg, const char* cName, const char* defaultName, const colormap::MapOptions<double>& opts) {
+	if(NULL != cName) {
+		std::unique_ptr<const colormap::Colormap<double, D> > handle = reg.make(cleanString(cName), opts);
+		if(handle) return handle;
+		std::stringstream ss;
+		ss << "couldn't find a color map matching '" << cName << "', falling back to default";
+		PyErr_WarnEx(NULL, ss.str().c_str(), 1);
+	}
+	return reg.make(defaultName, opts);
+}
+
 //@brief: convert a numpy array from 32 bit -> 8 bit
 //@param input: 32 bit numpy array with values [0,1]
 //@return: 8 bit numpy array with values [0,255]
@@ -529,6 +782,52 @@ PyObject* to8Bit(PyArrayObject* input) {
 	return (PyObject*)output;
 }
 
+//@brief: helper to gather valid coordinates and color them a block at a time (e.g. with a fused Luv -> 8 bit color function)
+template <size_t D, typename T = uint8_t>
+class ColorBatch {
+	public:
+		typedef std::function<void(double const * const * const, T * const, const size_t)> Func;//color function for arrays of D coordinates
+
+		//@brief       : construct a batch
+		//@param func  : function to color n points given D coordinate arrays
+		//@param rgb   : output array of colors
+		//@param stride: number of channels per color in output array
+		ColorBatch(Func func, T * const rgb, const size_t stride) : colorFunc(func), out(rgb), stride(stride), count(0) {}
+
+		//@brief  : add a point to the batch, coloring the batch if it is full
+		//@param i: index of point in output array
+		//@param x: coordinates of point
+		void push(const size_t i, const std::array<double, D>& x) {
+			for(size_t d = 0; d < D; d++) coords[d][count] = x[d];
+			index[count++] = i;
+			if(Size == count) flush();
+		}
+
+		//@brief: color all points in the batch (must be called once all points have been pushed)
+		void flush() {
+			if(0 == count) return;
+			double const * ptrs[D];
+			for(size_t d = 0; d < D; d++) ptrs[d] = coords[d];
+			if(index[count-1] - index[0] == count - 1) {//contiguous run of valid points, write directly to output
+				colorFunc(ptrs, out + stride * index[0], count);
+			} else {//scatter to output
+				colorFunc(ptrs, buff, count);
+				for(size_t j = 0; j < count; j++) std::copy(buff + stride * j, buff + stride * (j+1), out + stride * index[j]);
+			}
+			count = 0;
+		}
+
+	private:
+		static const size_t Size = color::detail::BatchSize;
+		Func            colorFunc      ;//function to compute colors
+		T       * const out            ;//output array
+		const size_t    stride         ;//channels per color
+		size_t          count          ;//number of points currently in batch
+		double          coords[D][Size];//coordinates of points in batch
+		size_t          index[Size]    ;//output indices of points in batch
+		T               buff[4 * Size] ;//working space for non contiguous batches
+};
+
 //@brief: helper function to find min/max element in range ignoring NANS (minmax_element doesn't handle nan) and compute scaling to [0,1]
 //@param data: pointer to start of range
 //@param count: number of elements
@@ -655,6 +954,27 @@ bool parseSym(PyObject* symName, colormap::Sym& sym) {
 	return true;
 }
 
+//@brief: convert from a gamut name to a color profile
+//@param cName: name of gamut to parse (or NULL for sRGB)
+//@param prof: location to write pointer to matching profile
+//@return: true on success, false on failure (PyErr will be set)
+bool getGamut(const char* cName, color::Profile<double> const *& prof) {
+	prof = &color::Profile<double>::sRGB();//default to sRGB
+	if(NULL == cName) return true;
+	const std::string name = cleanString(cName);
+	if     (0 == name.compare("srgb" )) prof = &color::Profile<double>::sRGB    ();
+	else if(0 == name.compare("adobe")) prof = &color::Profile<double>::adobeRGB();
+	else if(0 == name.compare("apple")) prof = &color::Profile<double>::appleRGB();
+	else if(0 == name.compare("pal"  )) prof = &color::Profile<double>::palRGB  ();
+	else if(0 == name.compare("ntsc" )) prof = &color::Profile<double>::ntscRGB ();
+	else if(0 == name.compare("cie"  )) prof = &color::Profile<double>::cieRGB  ();
+	else {
+		PyErr_SetString(PyExc_ValueError, "'gamut' must be one of {'srgb', 'adobe', 'apple', 'pal', 'ntsc', 'cie'}");
+		return false;
+	}
+	return true;
+}
+
 //@brief: get input array as double and count number of dimensions
 //@param array: PyObject to get as array of doubles
 //@param input: location to store pointer to array as doubles
@@ -681,6 +1001,51 @@ bool getArray(PyObject* array, PyArrayObject*& input, size_t& totalPoints, std::
 	return true;
 }
 
+//@brief: color an 8 or 16 bit integer array by gathering from a table with an entry for every possible value
+//@param array     : numpy array of Int to color
+//@param color     : function to compute a floating point color for a fractional position
+//@param color8    : function to compute an 8 bit color for a fractional position
+//@param scale     : true/false to map [min, max] of the array to [0,1] / use the raw values
+//@param alpha     : true/false to include an alpha channel
+//@param fp        : true/false to return array of doubles / uint8_t
+//@param fill      : fill value for values outside of [0,1]
+//@param fillPassed: true/false if the fill value was explicitly passed
+//@return          : array of rgb(a) values
+template <typename Int>
+static PyObject* indexed_wrapper(PyObject* array, std::function<void(const double, double * const)> color, std::function<void(const double, uint8_t * const)> color8, const bool scale, const bool alpha, const bool fp, const double fill, const bool fillPassed) {
+	//get input as a contiguous array (no copy for already contiguous arrays)
+	const int type = 1 == sizeof(Int) ? NPY_UINT8 : NPY_UINT16;
+	PyArrayObject* input = (PyArrayObject*)PyArray_FROM_OTF(array, type, NPY_ARRAY_IN_ARRAY);
+	if(input == NULL) {
+		PyErr_SetString(PyExc_ValueError, "couldn't convert input to contiguous numpy array of integers");
+		return NULL;
+	}
+	size_t totalPoints = 1;
+	std::vector<npy_intp> newDims(PyArray_DIMS(input), PyArray_DIMS(input) + PyArray_NDIM(input));
+	for(const npy_intp& d : newDims) totalPoints *= (size_t)d;
+	Int const * const values = (Int const*const)PyArray_DATA(input);
+
+	//the range is applied once to the table instead of to every pixel
+	double vMin = 0, vMax = 1;
+	if(scale && totalPoints > 0) {
+		const std::pair<Int const*, Int const*> mm = std::minmax_element(values, values + totalPoints);
+		vMin = *mm.first ;
+		vMax = *mm.second;
+	}
+
+	//create new array with an extra dimension tacked onto the end and gather colors into it
+	const size_t stride = alpha ? 4 : 3;
+	newDims.push_back(stride);//add rgb dimension
+	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), fp ? NPY_DOUBLE : NPY_UINT8, 0);
+	const bool outOfRange = fp ? colormap::IndexedLut<Int, double >(color , vMin, vMax, alpha, fill                       )(values, (double *const)PyArray_DATA(output), totalPoints)
+	                           : colormap::IndexedLut<Int, uint8_t>(color8, vMin, vMax, alpha, (uint8_t)std::round(fill * 255))(values, (uint8_t*const)PyArray_DATA(output), totalPoints);
+
+	//warn if the fill value was used without being explicitly passed and return
+	if(outOfRange && !fillPassed) PyErr_WarnEx(NULL, "values outside of [0,1] colored with the default fill value", 1);
+	Py_XDECREF(input);
+	return (PyObject*)output;
+}
+
 //@brief wrapper function for 1 parameter color maps (ramp + cyclic)
 //@template cyclic: true/false for cyclic/ramp color maps
 //@param self: NULL or object pointed to at module creation
@@ -692,26 +1057,73 @@ bool getArray(PyObject* array, PyArrayObject*& input, size_t& totalPoints, std::
 //             @keyword scale  : [optional] flag to rescale values to [0,1] before coloring
 //             @keyword alpha  : [optional] true / false to include an alpha channel
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
+//             @keyword uniform: [optional] true / false to map values through the inverse arc length of the map
+//             @keyword exact  : [optional] true / false to evaluate the map for every value / interpolate a cached 4096 entry table
 template<bool cyclic>
 static PyObject* linear_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 	static const char* defaultName = cyclic ? "four" : "fire";
-	static const colormap::ramp::func<double> defaultFunc = cyclic ? getCyclic(defaultName) : getRamp(defaultName);
-	static_assert(std::is_same<colormap::ramp::func<double>, colormap::cyclic::func<double> >::value, "ramp and cyclic color maps must have the same signature to share wrapper function as written");
+	typedef colormap::ramp::pfunc<double> Func ;
+	typedef colormap::ramp::func8<double> Func8;
+	static const Func  defaultFunc  = cyclic ? getCyclic<Func >(defaultName) : getRamp<Func >(defaultName);
+	static const Func8 defaultFunc8 = cyclic ? getCyclic<Func8>(defaultName) : getRamp<Func8>(defaultName);
+	static_assert(std::is_same<colormap::ramp::pfunc<double>, colormap::cyclic::pfunc<double> >::value, "ramp and cyclic color maps must have the same signature to share wrapper function as written");
+	static_assert(std::is_same<colormap::ramp::func8<double>, colormap::cyclic::func8<double> >::value, "ramp and cyclic color maps must have the same signature to share wrapper function as written");
 
 	//parse arguments
 	PyObject* array = NULL;
-	char* map = NULL;
+	char *map = NULL, *gamut = NULL;
 	double fill = -NAN;//technically this can be passed by float('-nan'), but shouldn't happen in normal use
-	int iScale = 0, iAlpha = 0, iFloat = 0;//python predicate takes a pointer to an int
-	static char const* kwlist[] = {"scalars", "map", /*begin keyword only*/ "fill", "scale", "alpha", "float", NULL};
-	if(!PyArg_ParseTupleAndKeywords(args, kwds, "O|s$dppp", const_cast<char**>(kwlist), &array, &map, &fill, &iScale, &iAlpha, &iFloat)) return NULL;
-	const bool scale = iScale != 0, alpha = iAlpha != 0, fp = iFloat != 0;//convert from int -> boolean
-
-	//parse color map function and fill value
-	colormap::ramp::func<double> colorFunc;
+	int iScale = 0, iAlpha = 0, iFloat = 0, iUniform = 0, iExact = 0;//python predicate takes a pointer to an int
+	static char const* kwlist[] = {"scalars", "map", /*begin keyword only*/ "fill", "scale", "alpha", "float", "gamut", "uniform", "exact", NULL};
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "O|s$dpppspp", const_cast<char**>(kwlist), &array, &map, &fill, &iScale, &iAlpha, &iFloat, &gamut, &iUniform, &iExact)) return NULL;
+	const bool scale = iScale != 0, alpha = iAlpha != 0, fp = iFloat != 0, uniform = iUniform != 0, exact = iExact != 0;//convert from int -> boolean
+
+	//parse color map function (maps registered at run time are checked first), fill value, and output color space
+	CustomMap * const custom = NULL == map ? NULL : getCustom(map, cyclic);
+	Func  colorFunc  = NULL;
+	Func8 colorFunc8 = NULL;
 	bool fillPassed;
-	getMap(colorFunc, map, defaultFunc, cyclic ? getCyclic : getRamp);
+	color::Profile<double> const * prof;
+	if(NULL == custom) {
+		if(fp || !exact) getMap(colorFunc , map, defaultFunc , cyclic ? getCyclic<Func > : getRamp<Func >);
+		else             getMap(colorFunc8, map, defaultFunc8, cyclic ? getCyclic<Func8> : getRamp<Func8>);
+	}
 	if(!getFill(fill, fillPassed)) return NULL;
+	if(!getGamut(gamut, prof)) return NULL;
+
+	//get the baked table for this map and gamut (built on the first call)
+	colormap::BakedLut<double> const * const baked = exact ? NULL : (NULL != custom ? &custom->baked(*prof) : &colormap::BakedLut<double>::cached(colorFunc, *prof, cyclic));
+
+	//get the sRGB function with the same name to select the arc length table for uniform mode (unknown names already fell back to the default)
+	typedef colormap::ramp::func<double> BaseFunc;
+	BaseFunc baseFunc = NULL == map ? NULL : (cyclic ? getCyclic<BaseFunc>(map) : getRamp<BaseFunc>(map));
+	if(NULL == baseFunc) baseFunc = cyclic ? getCyclic<BaseFunc>(defaultName) : getRamp<BaseFunc>(defaultName);
+	auto tFunc = [uniform, baseFunc, custom](const double t)->double{
+		if(!uniform) return t;
+		if(NULL != custom) return custom->lut.uniform(t);
+		return cyclic ? colormap::cyclic::uniform(baseFunc, t) : colormap::ramp::uniform(baseFunc, t);
+	};
+
+	//evaluate the map directly (exact mode)
+	auto exactColor  = [&](const double t, double * const c) {if(NULL != custom) custom->lut(t, c, *prof); else colorFunc(t, c, *prof);};
+	auto exactColor8 = [&](double const * const t, uint8_t * const c, const size_t n, const bool a) {if(NULL != custom) custom->lut(t, c, n, a, *prof); else colorFunc8(t, c, n, a, *prof, colormap::Backend::Float);};
+
+	//8 and 16 bit integer images are colored from a table with an entry for every possible value
+	const int type = PyArray_Check(array) ? PyArray_TYPE((PyArrayObject*)array) : NPY_NOTYPE;
+	if(NPY_UINT8 == type || NPY_UINT16 == type) {
+		auto color  = [&](const double t, double  * const c) {if(NULL != baked) (*baked)(tFunc(t), c); else exactColor(tFunc(t), c);};
+		auto color8 = [&](const double t, uint8_t * const c) {
+			if(NULL != baked) {
+				(*baked)(tFunc(t), c);
+			} else {
+				const double tt = tFunc(t);
+				exactColor8(&tt, c, 1, false);
+			}
+		};
+		return NPY_UINT8 == type ? indexed_wrapper<uint8_t >(array, color, color8, scale, alpha, fp, fill, fillPassed)
+		                         : indexed_wrapper<uint16_t>(array, color, color8, scale, alpha, fp, fill, fillPassed);
+	}
 
 	//get array object as doubles and its dimensions
 	PyArrayObject* input;
@@ -722,12 +1134,21 @@ static PyObject* linear_wrapper(PyObject* self, PyObject* args, PyObject* kwds)
 	//create new array with an extra dimension tacked onto the end
 	const size_t stride = alpha ? 4 : 3;
 	newDims.push_back(stride);//add rgb dimension
-	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), NPY_DOUBLE, 0);
+	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), fp ? NPY_DOUBLE : NPY_UINT8, 0);
 
 	//get data pointers
 	double const * const values = (double const*const)PyArray_DATA(input );
-	double       * const rgb    = (double      *const)PyArray_DATA(output);
-	if(alpha) for(size_t i = 0; i < totalPoints; i++) rgb[4*i+3] = 1.0;//fill in alpha channel with 1 if needed
+	double       * const rgb    = fp ? (double *const)PyArray_DATA(output) : NULL;
+	uint8_t      * const rgb8   = fp ? NULL : (uint8_t*const)PyArray_DATA(output);
+	if(alpha && fp) for(size_t i = 0; i < totalPoints; i++) rgb[4*i+3] = 1.0;//fill in alpha channel with 1 if needed (8 bit alpha is written with colors)
+
+	//8 bit colors are computed in batches straight from Luv, fill pixels are written directly
+	ColorBatch<1> batch([&](double const * const * const x, uint8_t * const c, const size_t n){exactColor8(x[0], c, n, alpha);}, rgb8, stride);
+	const uint8_t fill8 = (uint8_t)std::round(fill * 255);
+	auto fillPixel = [&](const size_t i) {
+		if(fp) std::fill(rgb  + stride * i, rgb  + stride * i + stride, fill );
+		else   std::fill(rgb8 + stride * i, rgb8 + stride * i + stride, fill8);
+	};
 
 	//loop over scalars computing color
 	bool hasNans = false;
@@ -743,9 +1164,15 @@ static PyObject* linear_wrapper(PyObject* self, PyObject* args, PyObject* kwds)
 			const double t = vFunc(values[i]);//get rescaled value
 			if(std::isnan(t)) {//handle NANs
 				hasNans = true;//at least once value was outside of [0,1]
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for out of range values
+				fillPixel(i);//use fill color for out of range values
+			} else if(NULL != baked) {
+				if(fp) (*baked)(tFunc(t), rgb  + stride * i);//interpolate color for non nan numbers
+				else   (*baked)(tFunc(t), rgb8 + stride * i);
+				if(alpha && !fp) rgb8[stride * i + 3] = 0xFF;
+			} else if(fp) {
+				exactColor(tFunc(t), rgb + stride * i);//compute color for non nan numbers
 			} else {
-				colorFunc(t, rgb + stride * i);//compute color for non nan numbers
+				batch.push(i, {{tFunc(t)}});//queue 8 bit color computation
 			}
 		}
 	} else {
@@ -754,21 +1181,28 @@ static PyObject* linear_wrapper(PyObject* self, PyObject* args, PyObject* kwds)
 			const double t = values[i];//get raw value
 			if(std::isnan(t)) {//handle NANs
 				hasNans = true;//at least once value was outside of [0,1]
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for NANs
+				fillPixel(i);//use fill color for NANs
 			} else if(t < 0.0 || t > 1.0) {//handle values outside of [0,1]
 				outOfRange = true;
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for out of range values
+				fillPixel(i);//use fill color for out of range values
+			} else if(NULL != baked) {
+				if(fp) (*baked)(tFunc(t), rgb  + stride * i);//interpolate color for valid values
+				else   (*baked)(tFunc(t), rgb8 + stride * i);
+				if(alpha && !fp) rgb8[stride * i + 3] = 0xFF;
+			} else if(fp) {
+				exactColor(tFunc(t), rgb + stride * i);//compute color for in valid values
 			} else {
-				colorFunc(t, rgb + stride * i);//compute color for in valid values
+				batch.push(i, {{tFunc(t)}});//queue 8 bit color computation
 			}
 		}
 	}
+	batch.flush();//color any remaining queued values
 
 	//warn if the fill value was used without being explicitly passed and return
 	if(hasNans &&    !fillPassed) PyErr_WarnEx(NULL, "NAN values were colored with the default fill value", 1);
 	if(outOfRange && !fillPassed) PyErr_WarnEx(NULL, "values outside of [0,1] colored with the default fill value", 1);
 	Py_XDECREF(input);
-	return fp ? (PyObject*)output : to8Bit(output);
+	return (PyObject*)output;
 }
 
 //@brief wrapper function for disk color maps
@@ -784,30 +1218,33 @@ static PyObject* linear_wrapper(PyObject* self, PyObject* args, PyObject* kwds)
 //             @keyword float          : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen          : true/false white/black center
 //             @keyword sym            : type of inversion symmetry to apply
+//             @keyword gamut          : [optional] name of rgb color space to return colors in
+//             @keyword exact          : [optional] true / false to evaluate the map for every pair / interpolate a cached polar table or cube map (default true)
 template <bool isSphere>
 static PyObject* circ_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 	static const char* defaultName = "four";
-	static const colormap::disk::func<double> defaultFunc = isSphere ? getSphere(defaultName) : getDisk(defaultName);
-	static_assert(std::is_same<colormap::disk::func<double>, colormap::sphere::func<double> >::value, "ramp and cyclic color maps must have the same signature to share wrapper function as written");
 	const std::string arg1 = isSphere ? "azimuths" : "radii" ;
 	const std::string arg2 = isSphere ? "polars"   : "angles";
 
 	//parse arguments
 	PyObject *array1 = NULL, *array2 = NULL, *symName = NULL;
-	char* map = NULL;
+	char *map = NULL, *gamut = NULL;
 	double fill = -NAN;//technically this can be passed by float('-nan'), but shouldn't happen in normal use
-	int iScale = 0, iAlpha = 0, iFloat = 0, iW0 = 0;//python predicate takes a pointer to an int
-	static char const* kwlist[] = {arg1.c_str(), arg2.c_str(), "map", /*begin keyword only*/ "fill", "scale", "alpha", "float", "w_cen", "sym", NULL};
-	if(!PyArg_ParseTupleAndKeywords(args, kwds, "OO|s$dppppO", const_cast<char**>(kwlist), &array1, &array2, &map, &fill, &iScale, &iAlpha, &iFloat, &iW0, &symName)) return NULL;
-	const bool scale = iScale != 0, alpha = iAlpha != 0, fp = iFloat != 0, w0 = iW0 != 0;//convert from int -> boolean
+	int iScale = 0, iAlpha = 0, iFloat = 0, iW0 = 0, iExact = 1;//python predicate takes a pointer to an int, tables are opt in (the maps were exact before they existed)
+	static char const* kwlist[] = {arg1.c_str(), arg2.c_str(), "map", /*begin keyword only*/ "fill", "scale", "alpha", "float", "w_cen", "sym", "gamut", "exact", NULL};
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "OO|s$dppppOsp", const_cast<char**>(kwlist), &array1, &array2, &map, &fill, &iScale, &iAlpha, &iFloat, &iW0, &symName, &gamut, &iExact)) return NULL;
+	const bool scale = iScale != 0, alpha = iAlpha != 0, fp = iFloat != 0, w0 = iW0 != 0, exact = iExact != 0;//convert from int -> boolean
 
-	//parse color map function, fill value, and symmetry
-	colormap::disk::func<double> colorFunc;
+	//parse fill value, symmetry, and output color space then build the color map (registered bicones are in the same registry)
 	bool fillPassed;
-	colormap::Sym sym;
-	getMap(colorFunc, map, defaultFunc, isSphere ? getSphere : getDisk);
+	colormap::MapOptions<double> opts;
+	opts.alpha = alpha;
+	opts.w0    = w0   ;
+	opts.be    = exact ? colormap::Backend::Float : colormap::Backend::Table;//only the predefined disk and sphere maps have tables, registered bicones are evaluated exactly
 	if(!getFill(fill, fillPassed)) return NULL;
-	if(!parseSym(symName, sym)) return NULL;
+	if(!parseSym(symName, opts.sym)) return NULL;
+	if(!getGamut(gamut, opts.prof)) return NULL;
+	const std::unique_ptr<const colormap::Colormap<double, 2> > cmap = getHandle(isSphere ? colormap::Registry<double, 2>::spheres() : colormap::Registry<double, 2>::disks(), map, defaultName, opts);
 
 	//get array objects as doubles and their dimensions
 	PyArrayObject *input1, *input2;
@@ -830,12 +1267,22 @@ static PyObject* circ_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 	//create new array with an extra dimension tacked onto the end
 	const size_t stride = alpha ? 4 : 3;
 	newDims.push_back(stride);//add rgb dimension
-	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), NPY_DOUBLE, 0);
+	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), fp ? NPY_DOUBLE : NPY_UINT8, 0);
 
 	//get array pointers
-	double const * const v1  = (double const*const)PyArray_DATA(input1);
-	double const * const v2  = (double const*const)PyArray_DATA(input2);
-	double       * const rgb = (double      *const)PyArray_DATA(output);
+	double const * const v1   = (double const*const)PyArray_DATA(input1);
+	double const * const v2   = (double const*const)PyArray_DATA(input2);
+	double       * const rgb  = fp ? (double *const)PyArray_DATA(output) : NULL;
+	uint8_t      * const rgb8 = fp ? NULL : (uint8_t*const)PyArray_DATA(output);
+
+	//colors are computed in batches (a single virtual call per batch), fill pixels are written directly
+	ColorBatch<2, double > batch ([&](double const * const * const x, double  * const c, const size_t n){cmap->map(x, n, c);}, rgb , stride);
+	ColorBatch<2, uint8_t> batch8([&](double const * const * const x, uint8_t * const c, const size_t n){cmap->map(x, n, c);}, rgb8, stride);
+	const uint8_t fill8 = (uint8_t)std::round(fill * 255);
+	auto fillPixel = [&](const size_t i) {
+		if(fp) std::fill(rgb  + stride * i, rgb  + stride * i + stride, fill );
+		else   std::fill(rgb8 + stride * i, rgb8 + stride * i + stride, fill8);
+	};
 	
 	//loop over scalars computing color
 	bool hasNans = false;
@@ -854,9 +1301,11 @@ static PyObject* circ_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 			const double& x2 = func2(v2[i]);//get rescaled value
 			if(std::isnan(x1) || std::isnan(x2)) {//handle NANs
 				hasNans = true;//at least once value was outside of [0,1]
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for out of range values
+				fillPixel(i);//use fill color for out of range values
+			} else if(fp) {
+				batch .push(i, {{x1, x2}});//queue color computation
 			} else {
-				colorFunc(x1, x2, rgb + stride * i, w0, sym);//compute color for in valid values
+				batch8.push(i, {{x1, x2}});//queue 8 bit color computation
 			}
 		}
 	} else {//use data as is
@@ -866,22 +1315,26 @@ static PyObject* circ_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 			const double& x2 = v2[i];//get raw value
 			if(std::isnan(x1) || std::isnan(x2)) {//handle NANs
 				hasNans = true;//at least once value was outside of [0,1]
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for NANs
+				fillPixel(i);//use fill color for NANs
 			} else if(x1 < 0.0 || x1 > 1.0 || x2 < 0.0 || x2 > 1.0) {//handle values outside of [0,1]
 				outOfRange = true;
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for out of range values
+				fillPixel(i);//use fill color for out of range values
+			} else if(fp) {
+				batch .push(i, {{x1, x2}});//queue color computation
 			} else {
-				colorFunc(x1, x2, rgb + stride * i, w0, sym);//compute color for in valid values
+				batch8.push(i, {{x1, x2}});//queue 8 bit color computation
 			}
 		}
 	}
+	batch .flush();//color any remaining queued values
+	batch8.flush();
 
 	//warn if the fill value was used without being explicitly passed and return
 	if(hasNans    && !fillPassed) PyErr_WarnEx(NULL, "NAN values were colored with the default fill value"        , 1);
 	if(outOfRange && !fillPassed) PyErr_WarnEx(NULL, "values outside of [0,1] colored with the default fill value", 1);
 	Py_XDECREF(input1);
 	Py_XDECREF(input2);
-	return fp ? (PyObject*)output : to8Bit(output);
+	return (PyObject*)output;
 }
 
 //@brief wrapper function for disk legend generation
@@ -937,7 +1390,7 @@ static PyObject* circ_legend_wrapper(PyObject* self, PyObject* args, PyObject* k
 	colormap::disk::func<double> colorFunc;
 	bool fillPassed;
 	colormap::Sym sym;
-	if(!getMap(colorFunc, map, (colormap::disk::func<double>) NULL, isSphere ? getSphere : getDisk)) return NULL;
+	if(!getMap(colorFunc, map, (colormap::disk::func<double>) NULL, isSphere ? getSphere<colormap::disk::func<double> > : getDisk<colormap::disk::func<double> >)) return NULL;
 	if(!getFill(fill, fillPassed)) return NULL;
 	if(!parseSym(symName, sym)) return NULL;
 
@@ -969,6 +1422,7 @@ static PyObject* circ_legend_wrapper(PyObject* self, PyObject* args, PyObject* k
 //             @keyword scale  : [optional] flag to rescale values to [0,1] before coloring
 //             @keyword alpha  : [optional] true / false to include an alpha channel
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
 static PyObject* ramp_wrapper  (PyObject* self, PyObject* args, PyObject* kwds) {return linear_wrapper<false>(self, args, kwds);}
 
 //@brief wrapper function for cyclic color maps
@@ -981,6 +1435,7 @@ static PyObject* ramp_wrapper  (PyObject* self, PyObject* args, PyObject* kwds)
 //             @keyword scale  : [optional] flag to rescale values to [0,1] before coloring
 //             @keyword alpha  : [optional] true / false to include an alpha channel
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
 static PyObject* cyclic_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {return linear_wrapper<true >(self, args, kwds);}
 
 //@brief wrapper function for disk color maps
@@ -996,6 +1451,8 @@ static PyObject* cyclic_wrapper(PyObject* self, PyObject* args, PyObject* kwds)
 //             @keyword float  : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen  : true/false white/black center
 //             @keyword sym    : type of inversion symmetry to apply
+//             @keyword gamut  : [optional] name of rgb color space to return colors in
+//             @keyword exact  : [optional] true / false to evaluate the map for every pair / interpolate a cached polar table (default true)
 static PyObject* disk_wrapper  (PyObject* self, PyObject* args, PyObject* kwds) {return circ_wrapper<false>(self, args, kwds);}
 
 //@brief wrapper function for sphere color maps
@@ -1011,6 +1468,8 @@ static PyObject* disk_wrapper  (PyObject* self, PyObject* args, PyObject* kwds)
 //             @keyword float   : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen   : true/false white/black center
 //             @keyword sym     : type of inversion symmetry to apply
+//             @keyword gamut   : [optional] name of rgb color space to return colors in
+//             @keyword exact   : [optional] true / false to evaluate the map for every pair / interpolate a cached cube map (default true)
 static PyObject* sphere_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {return circ_wrapper<true >(self, args, kwds);}
 
 //@brief wrapper function for ball color maps
@@ -1027,26 +1486,30 @@ static PyObject* sphere_wrapper(PyObject* self, PyObject* args, PyObject* kwds)
 //             @keyword float   : [optional] true / false to return array of doubles / uint8_t
 //             @keyword w_cen   : true/false white/black center
 //             @keyword sym     : type of inversion symmetry to apply
+//             @keyword gamut   : [optional] name of rgb color space to return colors in
+//             @keyword exact   : [optional] true / false to evaluate the map for every triplet / interpolate a cached voxel table (default true)
 static PyObject* ball_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 	static const char* defaultName = "four";
-	static const colormap::ball::func<double> defaultFunc = getBall(defaultName);
 
 	//parse arguments
 	PyObject *array1 = NULL, *array2 = NULL, *array3 = NULL, *symName = NULL;
-	char* map = NULL;
+	char *map = NULL, *gamut = NULL;
 	double fill = -NAN;//technically this can be passed by float('-nan'), but shouldn't happen in normal use
-	int iScale = 0, iAlpha = 0, iFloat = 0, iW0 = 0;//python predicate takes a pointer to an int
-	static char const* kwlist[] = {"radii", "azimuths", "polars", "map", /*begin keyword only*/ "fill", "scale", "alpha", "float", "w_cen", "sym", NULL};
-	if(!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|s$dppppO", const_cast<char**>(kwlist), &array1, &array2, &array3, &map, &fill, &iScale, &iAlpha, &iFloat, &iW0, &symName)) return NULL;
-	const bool scale = iScale != 0, alpha = iAlpha != 0, fp = iFloat != 0, w0 = iW0 != 0;//convert from int -> boolean
+	int iScale = 0, iAlpha = 0, iFloat = 0, iW0 = 0, iExact = 1;//python predicate takes a pointer to an int, the (7 MB) voxel tables are opt in
+	static char const* kwlist[] = {"radii", "azimuths", "polars", "map", /*begin keyword only*/ "fill", "scale", "alpha", "float", "w_cen", "sym", "gamut", "exact", NULL};
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|s$dppppOsp", const_cast<char**>(kwlist), &array1, &array2, &array3, &map, &fill, &iScale, &iAlpha, &iFloat, &iW0, &symName, &gamut, &iExact)) return NULL;
+	const bool scale = iScale != 0, alpha = iAlpha != 0, fp = iFloat != 0, w0 = iW0 != 0, exact = iExact != 0;//convert from int -> boolean
 
-	//parse color map function, fill value, and symmetry
-	colormap::ball::func<double> colorFunc;
+	//parse fill value, symmetry, and output color space then build the color map (registered bicones are in the same registry)
 	bool fillPassed;
-	colormap::Sym sym;
-	getMap(colorFunc, map, defaultFunc, getBall);
+	colormap::MapOptions<double> opts;
+	opts.alpha = alpha;
+	opts.w0    = w0   ;
+	opts.be    = exact ? colormap::Backend::Float : colormap::Backend::Table;//only the predefined ball maps have tables, registered bicones are evaluated exactly
 	if(!getFill(fill, fillPassed)) return NULL;
-	if(!parseSym(symName, sym)) return NULL;
+	if(!parseSym(symName, opts.sym)) return NULL;
+	if(!getGamut(gamut, opts.prof)) return NULL;
+	const std::unique_ptr<const colormap::Colormap<double, 3> > cmap = getHandle(colormap::Registry<double, 3>::balls(), map, defaultName, opts);
 
 	//get array objects as doubles and their dimensions
 	PyArrayObject *input1, *input2, *input3;
@@ -1075,13 +1538,23 @@ static PyObject* ball_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 	//create new array with an extra dimension tacked onto the end
 	const size_t stride = alpha ? 4 : 3;
 	newDims.push_back(stride);//add rgb dimension
-	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), NPY_DOUBLE, 0);
+	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), fp ? NPY_DOUBLE : NPY_UINT8, 0);
 
 	//get array pointers
-	double const * const v1  = (double const*const)PyArray_DATA(input1);
-	double const * const v2  = (double const*const)PyArray_DATA(input2);
-	double const * const v3  = (double const*const)PyArray_DATA(input3);
-	double       * const rgb = (double      *const)PyArray_DATA(output);
+	double const * const v1   = (double const*const)PyArray_DATA(input1);
+	double const * const v2   = (double const*const)PyArray_DATA(input2);
+	double const * const v3   = (double const*const)PyArray_DATA(input3);
+	double       * const rgb  = fp ? (double *const)PyArray_DATA(output) : NULL;
+	uint8_t      * const rgb8 = fp ? NULL : (uint8_t*const)PyArray_DATA(output);
+
+	//colors are computed in batches (a single virtual call per batch), fill pixels are written directly
+	ColorBatch<3, double > batch ([&](double const * const * const x, double  * const c, const size_t n){cmap->map(x, n, c);}, rgb , stride);
+	ColorBatch<3, uint8_t> batch8([&](double const * const * const x, uint8_t * const c, const size_t n){cmap->map(x, n, c);}, rgb8, stride);
+	const uint8_t fill8 = (uint8_t)std::round(fill * 255);
+	auto fillPixel = [&](const size_t i) {
+		if(fp) std::fill(rgb  + stride * i, rgb  + stride * i + stride, fill );
+		else   std::fill(rgb8 + stride * i, rgb8 + stride * i + stride, fill8);
+	};
 	
 	//loop over scalars computing color
 	bool hasNans = false;
@@ -1103,9 +1576,11 @@ static PyObject* ball_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 			const double& x3 = func2(v3[i]);//get rescaled value
 			if(std::isnan(x1) || std::isnan(x2) || std::isnan(x3)) {//handle NANs
 				hasNans = true;//at least once value was outside of [0,1]
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for out of range values
+				fillPixel(i);//use fill color for out of range values
+			} else if(fp) {
+				batch .push(i, {{x1, x2, x3}});//queue color computation
 			} else {
-				colorFunc(x1, x2, x3, rgb + stride * i, w0, sym);//compute color for in valid values
+				batch8.push(i, {{x1, x2, x3}});//queue 8 bit color computation
 			}
 		}
 	} else {//use data as is
@@ -1116,15 +1591,19 @@ static PyObject* ball_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 			const double& x3 = v3[i];//get raw value
 			if(std::isnan(x1) || std::isnan(x2) || std::isnan(x3)) {//handle NANs
 				hasNans = true;//at least once value was outside of [0,1]
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for NANs
+				fillPixel(i);//use fill color for NANs
 			} else if(x1 < 0.0 || x1 > 1.0 || x2 < 0.0 || x2 > 1.0 || x3 < 0.0 || x3 > 1.0) {//handle values outside of [0,1]
 				outOfRange = true;
-				std::fill(rgb + stride * i, rgb + stride * i + stride, fill);//use fill color for out of range values
+				fillPixel(i);//use fill color for out of range values
+			} else if(fp) {
+				batch .push(i, {{x1, x2, x3}});//queue color computation
 			} else {
-				colorFunc(x1, x2, x3, rgb + stride * i, w0, sym);//compute color for in valid values
+				batch8.push(i, {{x1, x2, x3}});//queue 8 bit color computation
 			}
 		}
 	}
+	batch .flush();//color any remaining queued values
+	batch8.flush();
 
 	//warn if the fill value was used without being explicitly passed and return
 	if(hasNans    && !fillPassed) PyErr_WarnEx(NULL, "NAN values were colored with the default fill value"        , 1);
@@ -1132,7 +1611,7 @@ static PyObject* ball_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
 	Py_XDECREF(input1);
 	Py_XDECREF(input2);
 	Py_XDECREF(input3);
-	return fp ? (PyObject*)output : to8Bit(output);
+	return (PyObject*)output;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1161,7 +1640,7 @@ static PyObject* ramp_legend_wrapper(PyObject* self, PyObject* args, PyObject* k
 
 	//check if a color map name was provided and select the corresponding function
 	colormap::ramp::func<double> colorFunc;
-	if(!getMap(colorFunc, map, (colormap::ramp::func<double>)NULL, getRamp)) return NULL;
+	if(!getMap(colorFunc, map, (colormap::ramp::func<double>)NULL, getRamp<colormap::ramp::func<double> >)) return NULL;
 
 	//build color map and return
 	npy_intp mapDims[3] = {(npy_intp)height, (npy_intp)width, alpha ? 4 : 3};//output array dimensions
@@ -1193,7 +1672,7 @@ static PyObject* cyclic_legend_wrapper(PyObject* self, PyObject* args, PyObject*
 	//parse color map function and fill value
 	colormap::ramp::func<double> colorFunc;
 	bool fillPassed;
-	if(!getMap(colorFunc, map, (colormap::ramp::func<double>)NULL, getCyclic)) return NULL;
+	if(!getMap(colorFunc, map, (colormap::ramp::func<double>)NULL, getCyclic<colormap::ramp::func<double> >)) return NULL;
 	if(!getFill(fill, fillPassed)) return NULL;
 
 	//build color map and return
@@ -1264,7 +1743,7 @@ static PyObject* ball_legend_wrapper(PyObject* self, PyObject* args, PyObject* k
 	colormap::ball::func<double> colorFunc;
 	bool fillPassed;
 	colormap::Sym sym;
-	if(!getMap(colorFunc, map, (colormap::ball::func<double>) NULL, getBall)) return NULL;
+	if(!getMap(colorFunc, map, (colormap::ball::func<double>) NULL, getBall<colormap::ball::func<double> >)) return NULL;
 	if(!getFill(fill, fillPassed)) return NULL;
 	if(!parseSym(symName, sym)) return NULL;
 
@@ -1275,4 +1754,202 @@ static PyObject* ball_legend_wrapper(PyObject* self, PyObject* args, PyObject* k
 	return fp ? (PyObject*)output : to8Bit(output);
 }
 
+////////////////////////////////////////////////////////////////
+//       Color Space Conversion Wrapper Implementations       //
+////////////////////////////////////////////////////////////////
+
+//@brief wrapper function for sRGB -> cie conversions
+//@template lab: true/false for Lab/Luv output
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword rgb: array of sRGB(A) colors to convert
+template <bool lab>
+static PyObject* cie_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
+	//parse arguments
+	PyObject* array = NULL;
+	static char const* kwlist[] = {"rgb", NULL};
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "O", const_cast<char**>(kwlist), &array)) return NULL;
+
+	//get input array keeping 8 and 16 bit integers as is (everything else is converted to doubles)
+	int type = NPY_DOUBLE;
+	if(PyArray_Check(array)) {
+		const int inType = PyArray_TYPE((PyArrayObject*)array);
+		if(NPY_UINT8 == inType || NPY_UINT16 == inType) type = inType;
+	}
+	PyArrayObject* input = (PyArrayObject*)PyArray_FROM_OTF(array, type, NPY_ARRAY_IN_ARRAY);
+	if(input == NULL) {
+		PyErr_SetString(PyExc_ValueError, "couldn't convert input to numpy array");
+		return NULL;
+	}
+
+	//make sure there are 3 or 4 channels and count colors
+	const int ndims = PyArray_NDIM(input);
+	npy_intp* dims = PyArray_DIMS(input);
+	const size_t channels = ndims > 0 ? (size_t)dims[ndims-1] : 0;
+	if(3 != channels && 4 != channels) {
+		PyErr_SetString(PyExc_ValueError, "last dimension of rgb must have 3 or 4 values");
+		Py_XDECREF(input);
+		return NULL;
+	}
+	size_t totalPoints = 1;
+	for(int i = 0; i < ndims - 1; i++) totalPoints *= (size_t)dims[i];
+
+	//create output array with 3 channels
+	std::vector<npy_intp> newDims(dims, dims + ndims);
+	newDims.back() = 3;
+	PyArrayObject* output = (PyArrayObject*)PyArray_EMPTY((int)newDims.size(), newDims.data(), NPY_DOUBLE, 0);
+	double * const cie = (double*)PyArray_DATA(output);
+
+	//convert
+	const color::Layout il = color::Layout::Interleaved;
+	double const * const ill = NULL;//D65
+	if(NPY_UINT8 == type) {
+		uint8_t  const * const rgb = (uint8_t  const*)PyArray_DATA(input);
+		lab ? color::rgb2lab(rgb, cie, totalPoints, il, ill, channels) : color::rgb2luv(rgb, cie, totalPoints, il, ill, channels);
+	} else if(NPY_UINT16 == type) {
+		uint16_t const * const rgb = (uint16_t const*)PyArray_DATA(input);
+		lab ? color::rgb2lab(rgb, cie, totalPoints, il, ill, channels) : color::rgb2luv(rgb, cie, totalPoints, il, ill, channels);
+	} else {
+		double const * const rgb = (double const*)PyArray_DATA(input);
+		for(size_t i = 0; i < totalPoints; i++) std::copy(rgb + channels * i, rgb + channels * i + 3, cie + 3 * i);//drop alpha channel
+		lab ? color::rgb2lab(cie, cie, totalPoints, il) : color::rgb2luv(cie, cie, totalPoints, il);
+	}
+	Py_XDECREF(input);
+	return (PyObject*)output;
+}
+
+//@brief wrapper function for sRGB -> Luv conversion
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword rgb: array of sRGB(A) colors to convert
+static PyObject* rgb2luv_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {return cie_wrapper<false>(self, args, kwds);}
+
+//@brief wrapper function for sRGB -> Lab conversion
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword rgb: array of sRGB(A) colors to convert
+static PyObject* rgb2lab_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {return cie_wrapper<true >(self, args, kwds);}
+
+//@brief wrapper function to register a ramp or cyclic color map built from Luv control points
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword name  : name to register map under
+//             @keyword luv   : n x 3 array of Luv control points
+//             @keyword cyclic: [optional] true / false to register a cyclic / ramp map
+static PyObject* register_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
+	//parse arguments
+	char* name = NULL;
+	PyObject* array = NULL;
+	int iCyclic = 0;//python predicate takes a pointer to an int
+	static char const* kwlist[] = {"name", "luv", /*begin keyword only*/ "cyclic", NULL};
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "sO|$p", const_cast<char**>(kwlist), &name, &array, &iCyclic)) return NULL;
+	const bool cyclic = iCyclic != 0;//convert from int -> boolean
+
+	//don't allow predefined maps to be shadowed
+	if(NULL != (cyclic ? getCyclic(name) : getRamp(name))) {
+		std::stringstream ss;
+		ss << "'" << name << "' is the name of a predefined " << (cyclic ? "cyclic" : "ramp") << " map";
+		PyErr_SetString(PyExc_ValueError, ss.str().c_str());
+		return NULL;
+	}
+
+	//get control points
+	PyArrayObject* input = NULL;
+	size_t totalPoints;
+	std::vector<npy_intp> dims;
+	if(!getArray(array, input, totalPoints, &dims)) return NULL;
+	if(2 != dims.size() || 3 != dims[1] || dims[0] < 2) {
+		PyErr_SetString(PyExc_ValueError, "luv must be an n x 3 array with at least 2 points");
+		Py_XDECREF(input);
+		return NULL;
+	}
+	double const * const luv = (double const*)PyArray_DATA(input);
+	const size_t n = (size_t)dims[0];
+	if(!std::all_of(luv, luv + totalPoints, [](const double v){return std::isfinite(v);})) {
+		PyErr_SetString(PyExc_ValueError, "luv control points must be finite");
+		Py_XDECREF(input);
+		return NULL;
+	}
+
+	//build spline and register (replacing any existing map with the same name, exceptions can't cross the C API so they become python errors)
+	bool built = false;
+	try {
+		std::unique_ptr<CustomMap> custom(new CustomMap(cyclic ? colormap::DynamicLut<double>::looped(luv, n) : colormap::DynamicLut<double>::padded(luv, n)));
+		customMaps(cyclic)[cleanString(name)] = std::move(custom);
+		built = true;
+	} catch (std::invalid_argument& e) {
+		PyErr_SetString(PyExc_ValueError, e.what());
+	} catch (std::exception& e) {
+		PyErr_SetString(PyExc_RuntimeError, e.what());
+	}
+	Py_XDECREF(input);
+	if(!built) return NULL;
+	Py_RETURN_NONE;
+}
+
+//@brief wrapper function to register a disk, sphere, and ball color map built from Luv equator colors
+//@param self: NULL or object pointed to at module creation
+//@param args: arguments
+//@param kwds: keywords
+//             @keyword name   : name to register map under
+//             @keyword corners: n x 3 array of Luv equator colors
+//             @keyword l0     : [optional] L* of the bottom pole
+//             @keyword l1     : [optional] L* of the top pole
+static PyObject* register_bicone_wrapper(PyObject* self, PyObject* args, PyObject* kwds) {
+	//parse arguments
+	char* name = NULL;
+	PyObject* array = NULL;
+	double l0 = 12, l1 = 98;//same poles as the predefined bicones
+	static char const* kwlist[] = {"name", "corners", /*begin keyword only*/ "l0", "l1", NULL};
+	if(!PyArg_ParseTupleAndKeywords(args, kwds, "sO|$dd", const_cast<char**>(kwlist), &name, &array, &l0, &l1)) return NULL;
+
+	//don't allow predefined maps to be shadowed
+	if(NULL != getDisk(name) || NULL != getSphere(name) || NULL != getBall(name)) {
+		std::stringstream ss;
+		ss << "'" << name << "' is the name of a predefined bicone map";
+		PyErr_SetString(PyExc_ValueError, ss.str().c_str());
+		return NULL;
+	}
+	if(!std::isfinite(l0) || !std::isfinite(l1)) {
+		PyErr_SetString(PyExc_ValueError, "pole lightness must be finite");
+		return NULL;
+	}
+
+	//get equator colors
+	PyArrayObject* input = NULL;
+	size_t totalPoints;
+	std::vector<npy_intp> dims;
+	if(!getArray(array, input, totalPoints, &dims)) return NULL;
+	if(2 != dims.size() || 3 != dims[1] || dims[0] < 2) {
+		PyErr_SetString(PyExc_ValueError, "corners must be an n x 3 array with at least 2 colors");
+		Py_XDECREF(input);
+		return NULL;
+	}
+	double const * const luv = (double const*)PyArray_DATA(input);
+	if(!std::all_of(luv, luv + totalPoints, [](const double v){return std::isfinite(v);})) {
+		PyErr_SetString(PyExc_ValueError, "corners must be finite");
+		Py_XDECREF(input);
+		return NULL;
+	}
+
+	//build bicone and add it to the disk, sphere, and ball registries (replacing any existing map with the same name)
+	//(the bicone rejects poles that don't bracket the equator lightness, exceptions can't cross the C API so they become python errors)
+	bool built = false;
+	try {
+		colormap::addBicone(cleanString(name), std::make_shared<const colormap::DynamicBicone<double> >(luv, (size_t)dims[0], l0, l1));
+		built = true;
+	} catch (std::invalid_argument& e) {
+		PyErr_SetString(PyExc_ValueError, e.what());
+	} catch (std::exception& e) {
+		PyErr_SetString(PyExc_RuntimeError, e.what());
+	}
+	Py_XDECREF(input);
+	if(!built) return NULL;
+	Py_RETURN_NONE;
+}
+
 #endif//_colormap_wrapper_h_
\ No newline at end of file